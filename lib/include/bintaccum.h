@@ -0,0 +1,62 @@
+﻿#pragma once
+
+#include "bintlib.h"
+
+class BigIntAccumulator
+{
+private:
+	std::vector<uint64_t> _positive;
+	std::vector<uint64_t> _negative;
+	uint64_t _pending;
+
+	static void normalize(std::vector<uint64_t>& sums);
+	static BigInt to_bigint(const std::vector<uint64_t>& sums);
+	void reserve(uint64_t count);
+	void accumulate(std::vector<uint64_t>& sums, const ChunkBuffer& chunks);
+	void accumulate_scalar(uint64_t number, bool is_negative);
+	void accumulate_product(const BigInt& lhs, const BigInt& rhs, bool is_negative);
+public:
+	static const uint64_t MAX_PENDING = UINT32_MAX - 1;
+
+	explicit BigIntAccumulator(size_t capacity = 0);
+
+	void clear();
+	size_t size() const;
+
+	BigIntAccumulator& add(const BigInt& number);
+	BigIntAccumulator& sub(const BigInt& number);
+	BigIntAccumulator& addmul(const BigInt& lhs, const BigInt& rhs);
+	BigIntAccumulator& submul(const BigInt& lhs, const BigInt& rhs);
+
+	BigInt result();
+
+	BigIntAccumulator& operator +=(const BigInt& number);
+	BigIntAccumulator& operator -=(const BigInt& number);
+
+	template <typename T, BigIntScalar<T> = 0> BigIntAccumulator& add(T number);
+	template <typename T, BigIntScalar<T> = 0> BigIntAccumulator& sub(T number);
+	template <typename T, BigIntScalar<T> = 0> BigIntAccumulator& operator +=(T number);
+	template <typename T, BigIntScalar<T> = 0> BigIntAccumulator& operator -=(T number);
+};
+
+template <typename T, BigIntScalar<T>>
+BigIntAccumulator& BigIntAccumulator::add(T number) {
+	accumulate_scalar(BigInt::scalar_abs(number), BigInt::scalar_is_negative(number));
+	return *this;
+}
+
+template <typename T, BigIntScalar<T>>
+BigIntAccumulator& BigIntAccumulator::sub(T number) {
+	accumulate_scalar(BigInt::scalar_abs(number), !BigInt::scalar_is_negative(number));
+	return *this;
+}
+
+template <typename T, BigIntScalar<T>>
+BigIntAccumulator& BigIntAccumulator::operator +=(T number) {
+	return add(number);
+}
+
+template <typename T, BigIntScalar<T>>
+BigIntAccumulator& BigIntAccumulator::operator -=(T number) {
+	return sub(number);
+}
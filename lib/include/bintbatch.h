@@ -0,0 +1,66 @@
+﻿#pragma once
+
+#include "bintlib.h"
+
+class BigIntBatch
+{
+private:
+	size_t _count;
+	size_t _limbs;
+	std::vector<uint32_t> _data;
+
+	void check_shape(const BigIntBatch& other) const;
+	void check_number(const BigInt& number) const;
+public:
+	static constexpr size_t TILE = 256;
+
+	BigIntBatch(size_t count, size_t limbs);
+
+	static BigIntBatch gather(const std::vector<BigInt>& numbers, size_t limbs);
+	static BigIntBatch broadcast(const BigInt& number, size_t count, size_t limbs);
+	std::vector<BigInt> scatter() const;
+
+	size_t count() const;
+	size_t limbs() const;
+	const uint32_t* limb(size_t index) const;
+	uint32_t* limb(size_t index);
+
+	BigInt get(size_t index) const;
+	void set(size_t index, const BigInt& number);
+
+	static BigIntBatch add(const BigIntBatch& lhs, const BigIntBatch& rhs);
+	static BigIntBatch sub(const BigIntBatch& lhs, const BigIntBatch& rhs);
+	static BigIntBatch mul(const BigIntBatch& lhs, const BigIntBatch& rhs);
+
+	bool operator ==(const BigIntBatch& other) const;
+	bool operator !=(const BigIntBatch& other) const;
+
+	friend class BatchMontgomeryContext;
+};
+
+class BatchMontgomeryContext
+{
+private:
+	BigInt _module;
+	size_t _limbs;
+	std::vector<uint32_t> _module_limbs;
+	uint32_t _m_inv;
+	BigInt _r1;
+	BigInt _r2;
+
+	void check_batch(const BigIntBatch& batch) const;
+public:
+	explicit BatchMontgomeryContext(const BigInt& module);
+
+	const BigInt& module() const;
+	size_t limbs() const;
+
+	BigIntBatch gather(const std::vector<BigInt>& numbers) const;
+	BigIntBatch to_montgomery(const BigIntBatch& numbers) const;
+	BigIntBatch from_montgomery(const BigIntBatch& numbers) const;
+
+	BigIntBatch add(const BigIntBatch& lhs, const BigIntBatch& rhs) const;
+	BigIntBatch sub(const BigIntBatch& lhs, const BigIntBatch& rhs) const;
+	BigIntBatch mul(const BigIntBatch& lhs, const BigIntBatch& rhs) const;
+	BigIntBatch pow(const BigIntBatch& numbers, const BigInt& degree) const;
+};
@@ -0,0 +1,173 @@
+﻿#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+class ChunkBuffer
+{
+private:
+#ifdef BINTLIB_COW
+	std::shared_ptr<std::vector<uint32_t>> _data;
+#else
+	std::vector<uint32_t> _data;
+#endif
+	size_t _offset;
+
+#ifdef BINTLIB_COW
+	static std::shared_ptr<std::vector<uint32_t>> make(std::vector<uint32_t>&& chunks) { return std::make_shared<std::vector<uint32_t>>(std::move(chunks)); }
+	const std::vector<uint32_t>& limbs() const { return *_data; }
+	std::vector<uint32_t>& detach() {
+		if (_data.use_count() > 1)
+			_data = make(std::vector<uint32_t>(*_data));
+		return *_data;
+	}
+#else
+	static std::vector<uint32_t> make(std::vector<uint32_t>&& chunks) { return std::move(chunks); }
+	const std::vector<uint32_t>& limbs() const { return _data; }
+	std::vector<uint32_t>& detach() { return _data; }
+#endif
+
+	std::vector<uint32_t>& materialize() {
+		if (_offset > 0) {
+			std::vector<uint32_t> chunks(_offset + limbs().size(), 0);
+			std::copy(limbs().begin(), limbs().end(), chunks.begin() + _offset);
+			_data = make(std::move(chunks));
+			_offset = 0;
+		}
+		return detach();
+	}
+public:
+	class const_iterator
+	{
+	private:
+		const ChunkBuffer* _buffer;
+		size_t _index;
+	public:
+		using iterator_category = std::random_access_iterator_tag;
+		using value_type = uint32_t;
+		using difference_type = std::ptrdiff_t;
+		using pointer = const uint32_t*;
+		using reference = uint32_t;
+
+		const_iterator(const ChunkBuffer* buffer = nullptr, size_t index = 0) : _buffer(buffer), _index(index) {}
+
+		uint32_t operator *() const { return (*_buffer)[_index]; }
+		uint32_t operator [](difference_type n) const { return (*_buffer)[_index + n]; }
+		const_iterator& operator ++() { ++_index; return *this; }
+		const_iterator operator ++(int) { return const_iterator(_buffer, _index++); }
+		const_iterator& operator --() { --_index; return *this; }
+		const_iterator operator --(int) { return const_iterator(_buffer, _index--); }
+		const_iterator& operator +=(difference_type n) { _index += n; return *this; }
+		const_iterator& operator -=(difference_type n) { _index -= n; return *this; }
+		const_iterator operator +(difference_type n) const { return const_iterator(_buffer, _index + n); }
+		const_iterator operator -(difference_type n) const { return const_iterator(_buffer, _index - n); }
+		difference_type operator -(const const_iterator& other) const { return (difference_type)_index - (difference_type)other._index; }
+		bool operator ==(const const_iterator& other) const { return _index == other._index; }
+		bool operator !=(const const_iterator& other) const { return _index != other._index; }
+		bool operator <(const const_iterator& other) const { return _index < other._index; }
+		bool operator >(const const_iterator& other) const { return _index > other._index; }
+		bool operator <=(const const_iterator& other) const { return _index <= other._index; }
+		bool operator >=(const const_iterator& other) const { return _index >= other._index; }
+	};
+
+	using value_type = uint32_t;
+	using iterator = std::vector<uint32_t>::iterator;
+
+	ChunkBuffer() : _data(make(std::vector<uint32_t>())), _offset(0) {}
+	ChunkBuffer(const std::vector<uint32_t>& chunks) : _data(make(std::vector<uint32_t>(chunks))), _offset(0) {}
+	ChunkBuffer(std::vector<uint32_t>&& chunks) : _data(make(std::move(chunks))), _offset(0) {}
+	ChunkBuffer(size_t count, uint32_t value) : _data(make(std::vector<uint32_t>(count, value))), _offset(0) {}
+	template <typename Iterator>
+	ChunkBuffer(Iterator first, Iterator last) : _data(make(std::vector<uint32_t>(first, last))), _offset(0) {}
+
+	ChunkBuffer& operator =(const std::vector<uint32_t>& chunks) {
+		_data = make(std::vector<uint32_t>(chunks));
+		_offset = 0;
+		return *this;
+	}
+	ChunkBuffer& operator =(std::vector<uint32_t>&& chunks) {
+		_data = make(std::move(chunks));
+		_offset = 0;
+		return *this;
+	}
+
+	size_t offset() const { return _offset; }
+	std::vector<uint32_t> to_vector() const {
+		std::vector<uint32_t> chunks(size(), 0);
+		std::copy(limbs().begin(), limbs().end(), chunks.begin() + _offset);
+		return chunks;
+	}
+	const std::vector<uint32_t>& stored() const { return limbs(); }
+	std::vector<uint32_t>& stored() { return detach(); }
+	void shift(size_t count) {
+		if (!limbs().empty())
+			_offset += count;
+	}
+	void drop(size_t count) {
+		if (count <= _offset) {
+			_offset -= count;
+			return;
+		}
+		std::vector<uint32_t>& chunks = detach();
+		chunks.erase(chunks.begin(), chunks.begin() + std::min(count - _offset, chunks.size()));
+		_offset = 0;
+	}
+
+	size_t size() const { return _offset + limbs().size(); }
+	bool empty() const { return size() == 0; }
+	uint32_t operator [](size_t index) const { return index < _offset ? 0 : limbs()[index - _offset]; }
+	uint32_t& operator [](size_t index) { return materialize()[index]; }
+	uint32_t back() const { return limbs().empty() ? 0 : limbs().back(); }
+	uint32_t& back() { return limbs().empty() ? materialize().back() : detach().back(); }
+	const_iterator begin() const { return const_iterator(this, 0); }
+	const_iterator end() const { return const_iterator(this, size()); }
+	iterator begin() { return materialize().begin(); }
+	iterator end() { return materialize().end(); }
+	uint32_t* data() { return materialize().data(); }
+
+	void push_back(uint32_t value) { detach().push_back(value); }
+	void pop_back() { (limbs().empty() ? materialize() : detach()).pop_back(); }
+	void clear() {
+		_data = make(std::vector<uint32_t>());
+		_offset = 0;
+	}
+	void resize(size_t count, uint32_t value = 0) {
+		if (count < _offset) {
+			clear();
+			_offset = count;
+			return;
+		}
+		detach().resize(count - _offset, value);
+	}
+	void reserve(size_t count) { detach().reserve(count > _offset ? count - _offset : 0); }
+	void swap(ChunkBuffer& other) {
+		_data.swap(other._data);
+		std::swap(_offset, other._offset);
+	}
+
+	template <typename... Args>
+	iterator insert(std::vector<uint32_t>::const_iterator position, Args&&... args) {
+		std::vector<uint32_t>& chunks = materialize();
+		return chunks.insert(position, std::forward<Args>(args)...);
+	}
+	iterator erase(std::vector<uint32_t>::const_iterator first, std::vector<uint32_t>::const_iterator last) {
+		std::vector<uint32_t>& chunks = materialize();
+		return chunks.erase(first, last);
+	}
+
+	bool operator ==(const ChunkBuffer& other) const {
+		if (size() != other.size())
+			return false;
+		if (_offset == other._offset)
+			return limbs() == other.limbs();
+		for (size_t i = std::min(_offset, other._offset); i < size(); ++i) {
+			if ((*this)[i] != other[i])
+				return false;
+		}
+		return true;
+	}
+	bool operator !=(const ChunkBuffer& other) const { return !(*this == other); }
+};
@@ -0,0 +1,66 @@
+﻿#pragma once
+
+#include <string>
+#include <fstream>
+#include "bintlib.h"
+
+class DiskBigInt
+{
+private:
+	struct Slice
+	{
+		const DiskBigInt* number;
+		size_t first;
+		size_t count;
+	};
+
+	struct Term
+	{
+		Slice slice;
+		size_t offset;
+		bool negative;
+	};
+
+	class ScratchFile
+	{
+	private:
+		std::string _path;
+	public:
+		explicit ScratchFile(const std::string& base);
+		~ScratchFile();
+
+		ScratchFile(const ScratchFile&) = delete;
+		ScratchFile& operator=(const ScratchFile&) = delete;
+
+		const std::string& path() const;
+	};
+
+	std::string _path;
+	size_t _size;
+	bool _is_negative;
+
+	static const size_t HEADER_CHUNKS = 1;
+
+	static std::vector<uint32_t> read_chunks(std::ifstream& stream, size_t first, size_t count);
+	static void write_chunks(std::ofstream& stream, const std::vector<uint32_t>& chunks);
+	static bool same_file(const std::string& lhs, const std::string& rhs);
+	static DiskBigInt combine(const std::vector<Term>& terms, size_t size, bool is_negative, const std::string& path, size_t block);
+	static DiskBigInt mul_slices(const Slice& lhs, const Slice& rhs, bool is_negative, const std::string& path, size_t block);
+
+	Slice slice() const;
+public:
+	static const size_t DEFAULT_MEMORY_BUDGET = (size_t)256 << 20;
+
+	explicit DiskBigInt(const std::string& path);
+
+	static DiskBigInt store(const BigInt& number, const std::string& path);
+	static DiskBigInt mul(const DiskBigInt& lhs, const DiskBigInt& rhs, const std::string& path, size_t memory_budget = DEFAULT_MEMORY_BUDGET);
+	static size_t block_size(size_t memory_budget);
+
+	const std::string& path() const;
+	size_t size() const;
+	bool is_negative() const;
+
+	BigInt load() const;
+	BigInt block(size_t first, size_t count) const;
+};
@@ -0,0 +1,481 @@
+﻿#pragma once
+
+#include <array>
+#include <type_traits>
+#include <cstddef>
+#include <cstdint>
+#include "bintlib.h"
+
+template <size_t Bits>
+class FixedBigUInt
+{
+	static_assert(Bits > 0 && Bits % 32 == 0, "Bit width must be a positive multiple of 32");
+public:
+	static const size_t SIZE = Bits / 32;
+
+private:
+	std::array<uint32_t, SIZE> _chunks;
+
+public:
+	constexpr FixedBigUInt() : _chunks{} {}
+
+	constexpr FixedBigUInt(uint64_t number) : _chunks{} {
+		_chunks[0] = (uint32_t)number;
+		if constexpr (SIZE > 1)
+			_chunks[1] = (uint32_t)(number >> 32);
+	}
+
+	constexpr explicit FixedBigUInt(const std::array<uint32_t, SIZE>& chunks) : _chunks(chunks) {}
+
+	template <size_t OtherBits, typename = std::enable_if_t<(OtherBits < Bits)>>
+	constexpr FixedBigUInt(const FixedBigUInt<OtherBits>& other) : _chunks{} {
+		for (size_t i = 0; i < FixedBigUInt<OtherBits>::SIZE; i++)
+			_chunks[i] = other.chunk(i);
+	}
+
+	explicit FixedBigUInt(const BigInt& number) : _chunks{} {
+		if (number._is_negative && number._chunks.back() != 0)
+			throw std::invalid_argument("Negative number cannot be stored as unsigned");
+		if (number.bit_length() > Bits)
+			throw std::invalid_argument("Number does not fit into fixed width");
+
+		for (size_t i = 0; i < number._chunks.size() && i < SIZE; i++)
+			_chunks[i] = number._chunks[i];
+	}
+
+	BigInt to_bigint() const {
+		std::vector<uint32_t> chunks(_chunks.begin(), _chunks.end());
+		while (chunks.size() > 1 && chunks.back() == 0)
+			chunks.pop_back();
+		return BigInt(chunks);
+	}
+
+	constexpr const std::array<uint32_t, SIZE>& chunks() const {
+		return _chunks;
+	}
+
+	constexpr uint32_t chunk(size_t index) const {
+		return _chunks[index];
+	}
+
+	constexpr bool is_zero() const {
+		for (size_t i = 0; i < SIZE; i++) {
+			if (_chunks[i] != 0)
+				return false;
+		}
+		return true;
+	}
+
+	constexpr bool test_bit(size_t index) const {
+		return (_chunks[index / 32] >> (index % 32)) & 1;
+	}
+
+	constexpr size_t bit_length() const {
+		for (size_t i = SIZE; i > 0; i--) {
+			uint32_t chunk = _chunks[i - 1];
+			if (chunk != 0) {
+				size_t bits = 0;
+				while (chunk != 0) {
+					chunk >>= 1;
+					bits++;
+				}
+				return (i - 1) * 32 + bits;
+			}
+		}
+		return 0;
+	}
+
+	static constexpr int cmp(const FixedBigUInt& lhs, const FixedBigUInt& rhs) {
+		for (size_t i = SIZE; i > 0; i--) {
+			if (lhs._chunks[i - 1] > rhs._chunks[i - 1])
+				return 1;
+			if (lhs._chunks[i - 1] < rhs._chunks[i - 1])
+				return -1;
+		}
+		return 0;
+	}
+
+	static constexpr uint32_t add_to(FixedBigUInt& lhs, const FixedBigUInt& rhs) {
+		uint64_t carry = 0;
+		for (size_t i = 0; i < SIZE; i++) {
+			uint64_t sum = (uint64_t)lhs._chunks[i] + rhs._chunks[i] + carry;
+			lhs._chunks[i] = (uint32_t)sum;
+			carry = sum >> 32;
+		}
+		return (uint32_t)carry;
+	}
+
+	static constexpr uint32_t sub_from(FixedBigUInt& lhs, const FixedBigUInt& rhs) {
+		uint64_t borrow = 0;
+		for (size_t i = 0; i < SIZE; i++) {
+			uint64_t diff = (uint64_t)lhs._chunks[i] - rhs._chunks[i] - borrow;
+			lhs._chunks[i] = (uint32_t)diff;
+			borrow = diff >> 63;
+		}
+		return (uint32_t)borrow;
+	}
+
+	static constexpr FixedBigUInt<2 * Bits> mul_wide(const FixedBigUInt& lhs, const FixedBigUInt& rhs) {
+		std::array<uint32_t, 2 * SIZE> res_chunks{};
+
+		for (size_t i = 0; i < SIZE; i++) {
+			uint64_t carry = 0;
+			for (size_t j = 0; j < SIZE; j++) {
+				uint64_t sum = (uint64_t)lhs._chunks[i] * rhs._chunks[j] + res_chunks[i + j] + carry;
+				res_chunks[i + j] = (uint32_t)sum;
+				carry = sum >> 32;
+			}
+			res_chunks[i + SIZE] = (uint32_t)carry;
+		}
+
+		return FixedBigUInt<2 * Bits>(res_chunks);
+	}
+
+	constexpr FixedBigUInt operator +(const FixedBigUInt& other) const {
+		FixedBigUInt result = *this;
+		add_to(result, other);
+		return result;
+	}
+
+	constexpr FixedBigUInt operator -(const FixedBigUInt& other) const {
+		FixedBigUInt result = *this;
+		sub_from(result, other);
+		return result;
+	}
+
+	constexpr FixedBigUInt operator *(const FixedBigUInt& other) const {
+		FixedBigUInt result;
+
+		for (size_t i = 0; i < SIZE; i++) {
+			uint64_t carry = 0;
+			for (size_t j = 0; i + j < SIZE; j++) {
+				uint64_t sum = (uint64_t)_chunks[i] * other._chunks[j] + result._chunks[i + j] + carry;
+				result._chunks[i + j] = (uint32_t)sum;
+				carry = sum >> 32;
+			}
+		}
+
+		return result;
+	}
+
+	constexpr FixedBigUInt operator <<(uint32_t shift) const {
+		FixedBigUInt result;
+		size_t chunk_shift = shift / 32;
+		uint32_t bit_shift = shift % 32;
+
+		for (size_t i = SIZE; i > chunk_shift; i--) {
+			size_t index = i - 1 - chunk_shift;
+			uint32_t chunk = _chunks[index] << bit_shift;
+			if (bit_shift > 0 && index > 0)
+				chunk |= _chunks[index - 1] >> (32 - bit_shift);
+			result._chunks[i - 1] = chunk;
+		}
+
+		return result;
+	}
+
+	constexpr FixedBigUInt operator >>(uint32_t shift) const {
+		FixedBigUInt result;
+		size_t chunk_shift = shift / 32;
+		uint32_t bit_shift = shift % 32;
+
+		for (size_t i = 0; i + chunk_shift < SIZE; i++) {
+			size_t index = i + chunk_shift;
+			uint32_t chunk = _chunks[index] >> bit_shift;
+			if (bit_shift > 0 && index + 1 < SIZE)
+				chunk |= _chunks[index + 1] << (32 - bit_shift);
+			result._chunks[i] = chunk;
+		}
+
+		return result;
+	}
+
+	constexpr FixedBigUInt operator ~() const {
+		FixedBigUInt result;
+		for (size_t i = 0; i < SIZE; i++)
+			result._chunks[i] = ~_chunks[i];
+		return result;
+	}
+
+	constexpr FixedBigUInt& operator +=(const FixedBigUInt& other) {
+		add_to(*this, other);
+		return *this;
+	}
+
+	constexpr FixedBigUInt& operator -=(const FixedBigUInt& other) {
+		sub_from(*this, other);
+		return *this;
+	}
+
+	constexpr FixedBigUInt& operator *=(const FixedBigUInt& other) {
+		*this = *this * other;
+		return *this;
+	}
+
+	constexpr FixedBigUInt& operator <<=(uint32_t shift) {
+		*this = *this << shift;
+		return *this;
+	}
+
+	constexpr FixedBigUInt& operator >>=(uint32_t shift) {
+		*this = *this >> shift;
+		return *this;
+	}
+
+	constexpr bool operator ==(const FixedBigUInt& other) const {
+		return cmp(*this, other) == 0;
+	}
+
+	constexpr bool operator !=(const FixedBigUInt& other) const {
+		return cmp(*this, other) != 0;
+	}
+
+	constexpr bool operator >(const FixedBigUInt& other) const {
+		return cmp(*this, other) > 0;
+	}
+
+	constexpr bool operator <(const FixedBigUInt& other) const {
+		return cmp(*this, other) < 0;
+	}
+
+	constexpr bool operator >=(const FixedBigUInt& other) const {
+		return cmp(*this, other) >= 0;
+	}
+
+	constexpr bool operator <=(const FixedBigUInt& other) const {
+		return cmp(*this, other) <= 0;
+	}
+};
+
+template <size_t Bits>
+class FixedBigInt
+{
+private:
+	FixedBigUInt<Bits> _value;
+
+	static constexpr FixedBigUInt<Bits> sign_extend(int64_t number) {
+		std::array<uint32_t, FixedBigUInt<Bits>::SIZE> chunks{};
+		for (size_t i = 0; i < chunks.size(); i++)
+			chunks[i] = (number < 0) ? UINT32_MAX : 0;
+
+		chunks[0] = (uint32_t)number;
+		if constexpr (FixedBigUInt<Bits>::SIZE > 1)
+			chunks[1] = (uint32_t)((uint64_t)number >> 32);
+		return FixedBigUInt<Bits>(chunks);
+	}
+
+public:
+	constexpr FixedBigInt() : _value() {}
+
+	constexpr FixedBigInt(int64_t number) : _value(sign_extend(number)) {}
+
+	constexpr explicit FixedBigInt(const FixedBigUInt<Bits>& value) : _value(value) {}
+
+	explicit FixedBigInt(const BigInt& number) : _value(BigInt::abs(number)) {
+		if (_value.test_bit(Bits - 1) && !(number._is_negative && _value == (FixedBigUInt<Bits>(1) << (Bits - 1))))
+			throw std::invalid_argument("Number does not fit into fixed width");
+		if (number._is_negative)
+			_value = FixedBigUInt<Bits>() - _value;
+	}
+
+	BigInt to_bigint() const {
+		if (is_negative())
+			return -(FixedBigUInt<Bits>() - _value).to_bigint();
+		return _value.to_bigint();
+	}
+
+	constexpr const FixedBigUInt<Bits>& bits() const {
+		return _value;
+	}
+
+	constexpr bool is_negative() const {
+		return _value.test_bit(Bits - 1);
+	}
+
+	static constexpr int cmp(const FixedBigInt& lhs, const FixedBigInt& rhs) {
+		if (lhs.is_negative() != rhs.is_negative())
+			return lhs.is_negative() ? -1 : 1;
+		return FixedBigUInt<Bits>::cmp(lhs._value, rhs._value);
+	}
+
+	constexpr FixedBigInt operator +(const FixedBigInt& other) const {
+		return FixedBigInt(_value + other._value);
+	}
+
+	constexpr FixedBigInt operator -(const FixedBigInt& other) const {
+		return FixedBigInt(_value - other._value);
+	}
+
+	constexpr FixedBigInt operator -() const {
+		return FixedBigInt(FixedBigUInt<Bits>() - _value);
+	}
+
+	constexpr FixedBigInt operator *(const FixedBigInt& other) const {
+		return FixedBigInt(_value * other._value);
+	}
+
+	constexpr FixedBigInt operator <<(uint32_t shift) const {
+		return FixedBigInt(_value << shift);
+	}
+
+	constexpr FixedBigInt operator >>(uint32_t shift) const {
+		if (!is_negative())
+			return FixedBigInt(_value >> shift);
+		return FixedBigInt(~(~_value >> shift));
+	}
+
+	constexpr FixedBigInt& operator +=(const FixedBigInt& other) {
+		_value += other._value;
+		return *this;
+	}
+
+	constexpr FixedBigInt& operator -=(const FixedBigInt& other) {
+		_value -= other._value;
+		return *this;
+	}
+
+	constexpr FixedBigInt& operator *=(const FixedBigInt& other) {
+		_value *= other._value;
+		return *this;
+	}
+
+	constexpr bool operator ==(const FixedBigInt& other) const {
+		return _value == other._value;
+	}
+
+	constexpr bool operator !=(const FixedBigInt& other) const {
+		return _value != other._value;
+	}
+
+	constexpr bool operator >(const FixedBigInt& other) const {
+		return cmp(*this, other) > 0;
+	}
+
+	constexpr bool operator <(const FixedBigInt& other) const {
+		return cmp(*this, other) < 0;
+	}
+
+	constexpr bool operator >=(const FixedBigInt& other) const {
+		return cmp(*this, other) >= 0;
+	}
+
+	constexpr bool operator <=(const FixedBigInt& other) const {
+		return cmp(*this, other) <= 0;
+	}
+};
+
+template <size_t Bits>
+class FixedMontgomery
+{
+public:
+	static const size_t SIZE = FixedBigUInt<Bits>::SIZE;
+
+private:
+	FixedBigUInt<Bits> _module;
+	FixedBigUInt<Bits> _r1;
+	FixedBigUInt<Bits> _r2;
+	uint32_t _m_inv;
+
+	static constexpr FixedBigUInt<Bits> double_mod(const FixedBigUInt<Bits>& number, const FixedBigUInt<Bits>& module) {
+		uint32_t carry = number.chunk(SIZE - 1) >> 31;
+		FixedBigUInt<Bits> result = number << 1;
+		if (carry != 0 || result >= module)
+			result -= module;
+		return result;
+	}
+
+public:
+	constexpr explicit FixedMontgomery(const FixedBigUInt<Bits>& module) : _module(module), _r1(), _r2(), _m_inv(0) {
+		if ((module.chunk(0) & 1) == 0)
+			throw std::invalid_argument("Module must be odd");
+
+		uint32_t inv = module.chunk(0);
+		for (size_t i = 0; i < 4; i++)
+			inv *= 2 - module.chunk(0) * inv;
+		_m_inv = 0 - inv;
+
+		FixedBigUInt<Bits> acc = FixedBigUInt<Bits>(1);
+		if (acc >= module)
+			acc = FixedBigUInt<Bits>();
+		for (size_t i = 0; i < Bits; i++)
+			acc = double_mod(acc, module);
+		_r1 = acc;
+		for (size_t i = 0; i < Bits; i++)
+			acc = double_mod(acc, module);
+		_r2 = acc;
+	}
+
+	constexpr const FixedBigUInt<Bits>& module() const {
+		return _module;
+	}
+
+	constexpr FixedBigUInt<Bits> mul(const FixedBigUInt<Bits>& lhs, const FixedBigUInt<Bits>& rhs) const {
+		std::array<uint32_t, SIZE + 2> t{};
+
+		for (size_t i = 0; i < SIZE; i++) {
+			uint64_t carry = 0;
+			for (size_t j = 0; j < SIZE; j++) {
+				uint64_t sum = (uint64_t)lhs.chunk(j) * rhs.chunk(i) + t[j] + carry;
+				t[j] = (uint32_t)sum;
+				carry = sum >> 32;
+			}
+			uint64_t sum = (uint64_t)t[SIZE] + carry;
+			t[SIZE] = (uint32_t)sum;
+			t[SIZE + 1] = (uint32_t)(sum >> 32);
+
+			uint32_t m = t[0] * _m_inv;
+			sum = (uint64_t)m * _module.chunk(0) + t[0];
+			carry = sum >> 32;
+			for (size_t j = 1; j < SIZE; j++) {
+				sum = (uint64_t)m * _module.chunk(j) + t[j] + carry;
+				t[j - 1] = (uint32_t)sum;
+				carry = sum >> 32;
+			}
+			sum = (uint64_t)t[SIZE] + carry;
+			t[SIZE - 1] = (uint32_t)sum;
+			t[SIZE] = t[SIZE + 1] + (uint32_t)(sum >> 32);
+		}
+
+		std::array<uint32_t, SIZE> res_chunks{};
+		for (size_t i = 0; i < SIZE; i++)
+			res_chunks[i] = t[i];
+
+		FixedBigUInt<Bits> result(res_chunks);
+		if (t[SIZE] != 0 || result >= _module)
+			result -= _module;
+		return result;
+	}
+
+	constexpr FixedBigUInt<Bits> to_montgomery(const FixedBigUInt<Bits>& number) const {
+		return mul(number, _r2);
+	}
+
+	constexpr FixedBigUInt<Bits> from_montgomery(const FixedBigUInt<Bits>& number) const {
+		return mul(number, FixedBigUInt<Bits>(1));
+	}
+
+	constexpr FixedBigUInt<Bits> mul_mod(const FixedBigUInt<Bits>& lhs, const FixedBigUInt<Bits>& rhs) const {
+		return mul(mul(lhs, rhs), _r2);
+	}
+
+	template <size_t DegreeBits>
+	constexpr FixedBigUInt<Bits> pow(const FixedBigUInt<Bits>& number, const FixedBigUInt<DegreeBits>& degree) const {
+		std::array<FixedBigUInt<Bits>, 16> factors{};
+		factors[0] = _r1;
+		factors[1] = to_montgomery(number);
+		for (size_t i = 2; i < 16; i++)
+			factors[i] = mul(factors[i - 1], factors[1]);
+
+		FixedBigUInt<Bits> acc = _r1;
+		for (size_t i = (degree.bit_length() + 3) / 4; i > 0; i--) {
+			for (size_t j = 0; j < 4; j++)
+				acc = mul(acc, acc);
+
+			uint32_t factor_index = (degree.chunk((i - 1) / 8) >> (((i - 1) % 8) * 4)) & 0xF;
+			if (factor_index != 0)
+				acc = mul(acc, factors[factor_index]);
+		}
+
+		return from_montgomery(acc);
+	}
+};
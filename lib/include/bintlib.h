@@ -1,63 +1,149 @@
 ﻿#pragma once
 
 #include <list>
+#include <algorithm>
+#include <bitset>
 #include <tuple>
 #include <vector>
+#include <cstdint>
 #include <string>
 #include <iostream>
 #include <exception>
+#include <stdexcept>
+#include <type_traits>
+#include "bintchunks.h"
+
+class BarrettContext;
+
+template <typename T>
+using BigIntScalar = std::enable_if_t<std::is_integral_v<T> && !std::is_same_v<T, bool>, int>;
 
 class BigInt
 {
 private:
 	bool _is_negative;
-	std::vector<uint32_t> _chunks;
+	ChunkBuffer _chunks;
+
+	static uint64_t div_chunks_scalar(const BigInt& number, uint64_t divider, std::vector<uint32_t>* quotient_chunks);
+	static BigInt reciprocal(const BigInt& divider);
+	static std::pair<BigInt, BigInt> div_newton(const BigInt& dividend, const BigInt& divider);
+	static BigInt chunk_slice(const BigInt& number, size_t first, size_t count);
+	static void add_chunks(std::vector<uint32_t>& chunks, const BigInt& number, size_t offset);
+	static void sub_chunks_at(std::vector<uint32_t>& chunks, const BigInt& number, size_t offset);
+	static size_t low_zero_chunks(const BigInt& number);
+	static BigInt assemble(std::vector<uint32_t>&& chunks, size_t offset, bool is_negative);
+	static size_t checked_size(uint64_t chunks);
+	static uint32_t complement_chunk(const BigInt& number, size_t index, size_t low_zeros);
+	template <typename Op>
+	static BigInt bitwise(const BigInt& lhs, const BigInt& rhs, Op op);
+	template <typename Op>
+	void bitwise_assign(const BigInt& other, Op op);
 public:
 	static const uint64_t BASE = (uint64_t)UINT32_MAX + 1;
+	static const size_t MUL_KARATSUBA_THRESHOLD = 32;
+	static const size_t SQR_KARATSUBA_THRESHOLD = 32;
+	static const size_t DIV_NEWTON_THRESHOLD = 256;
+	static const uint64_t BINOMIAL_FALLING_FACTOR = 4;
+	static const size_t MAX_CHUNKS = (size_t)std::min<uint64_t>(PTRDIFF_MAX / sizeof(uint32_t), UINT64_MAX / 32);
 
 	BigInt(uint32_t number = 0, bool is_negative = false);
 	BigInt(const std::string& number);
 	BigInt(const std::vector<uint32_t>& chunks, bool is_negative= false);
+	BigInt(const BigInt& other) = default;
+	BigInt(BigInt&& other) noexcept = default;
 
 	static std::vector<uint32_t> parse_number(const std::string& number, uint64_t base = (uint64_t)UINT32_MAX + 1);
 	static std::string concat_number(const std::vector<uint32_t>& chunks, bool is_negative = false, uint64_t base = (uint64_t)UINT32_MAX + 1);
 	static int abs_cmp(const BigInt& number1, const BigInt& number2);
 	static BigInt sub_chunks(const BigInt& lhs, const BigInt& rhs);
 	static uint32_t leading_zeros(uint32_t value);
+	static uint32_t trailing_zeros(uint32_t value);
+	static uint32_t word_inverse(uint32_t number);
 	static uint32_t estimate_quotient(const BigInt& dividend, const BigInt& divider);
+	static uint32_t reciprocal_word(uint32_t divider);
+	static uint32_t reciprocal_3by2(uint32_t high, uint32_t low);
+	static uint32_t div_2by1(uint32_t high, uint32_t low, uint32_t divider, uint32_t reciprocal, uint32_t& remainder);
+	static uint32_t div_3by2(uint32_t high, uint32_t middle, uint32_t low, uint64_t divider, uint32_t reciprocal, uint64_t& remainder);
+
+	template <typename T, BigIntScalar<T> = 0>
+	static uint64_t scalar_abs(T number);
+	template <typename T, BigIntScalar<T> = 0>
+	static bool scalar_is_negative(T number);
+	static BigInt from_scalar(uint64_t number, bool is_negative = false);
+	static int abs_cmp_scalar(const BigInt& lhs, uint64_t rhs);
+	static int cmp_scalar(const BigInt& lhs, uint64_t rhs, bool rhs_negative = false);
+	static BigInt sum_scalar(const BigInt& lhs, uint64_t rhs, bool rhs_negative = false);
+	static BigInt sub_scalar(const BigInt& lhs, uint64_t rhs, bool rhs_negative = false);
+	static BigInt mul_scalar(const BigInt& lhs, uint64_t rhs, bool rhs_negative = false);
+	static std::pair<BigInt, uint64_t> div_scalar(const BigInt& lhs, uint64_t rhs, bool rhs_negative = false);
+	static uint64_t mod_scalar(const BigInt& lhs, uint64_t rhs);
 
 	static BigInt abs(const BigInt& number);
 	static BigInt sum(const BigInt& lhs, const BigInt& rhs);
 	static BigInt sub(const BigInt& lhs, const BigInt& rhs);
 	static BigInt simple_mul(const BigInt& lhs, const BigInt& rhs);
 	static BigInt karatsuba_mul(const BigInt& lhs, const BigInt& rhs);
+	static BigInt toom32_mul(const BigInt& lhs, const BigInt& rhs);
+	static BigInt toom42_mul(const BigInt& lhs, const BigInt& rhs);
+	static BigInt unbalanced_mul(const BigInt& lhs, const BigInt& rhs);
+	static BigInt sqr_basecase(const BigInt& number);
 	static BigInt karatsuba_square(const BigInt& number);
 	static std::pair<BigInt, BigInt> div(const BigInt& lhs, const BigInt& rhs);
+	static BigInt divexact(const BigInt& dividend, const BigInt& divider);
+	static BigInt divexact(const BigInt& dividend, uint32_t divider);
 	static BigInt mod(const BigInt& lhs, const BigInt& rhs);
+	static BigInt mod(const BigInt& lhs, const BarrettContext& context);
 	static BigInt gcd(const BigInt& lhs, const BigInt& rhs);
+	static BigInt lcm(const BigInt& lhs, const BigInt& rhs);
 	static std::tuple<BigInt, BigInt, BigInt> extended_gcd(const BigInt& lhs, const BigInt& rhs);
-	static BigInt BigInt::mod_inverse(const BigInt& a, const BigInt& m);
-	static BigInt left_shift(const BigInt& number, uint32_t shift);
-	static BigInt right_shift(const BigInt& number, uint32_t shift);
+	static BigInt mod_inverse(const BigInt& a, const BigInt& m);
+	static BigInt left_shift(const BigInt& number, uint64_t shift);
+	static BigInt right_shift(const BigInt& number, uint64_t shift);
+	static BigInt bit_and(const BigInt& lhs, const BigInt& rhs);
+	static BigInt bit_or(const BigInt& lhs, const BigInt& rhs);
+	static BigInt bit_xor(const BigInt& lhs, const BigInt& rhs);
+	static BigInt bit_not(const BigInt& number);
+	static BigInt low_bits(const BigInt& number, uint64_t count);
 	static BigInt montgomery(const BigInt& rhs, const BigInt& lhs, const BigInt& module, const BigInt& R, const BigInt& n_prime);
 	static BigInt montgomery_mul(const BigInt& rhs, const BigInt& lhs, const BigInt& module);
 	static BigInt binary_pow(const BigInt& number, const BigInt& degree);
 	static BigInt pow(const BigInt& number, const BigInt& degree, uint32_t base = 2);
 	static BigInt montgomery_pow(const BigInt& number, const BigInt& degree, const BigInt& module, uint32_t base = 2);
+	static BigInt multi_pow_mod(const std::vector<BigInt>& numbers, const std::vector<BigInt>& degrees, const BigInt& module);
+	static BigInt product(const std::vector<BigInt>& numbers, size_t threads = 1);
+	static BigInt factorial(uint32_t n, size_t threads = 1);
+	static BigInt binomial(uint32_t n, uint32_t k, size_t threads = 1);
+	static BigInt primorial(uint32_t n, size_t threads = 1);
+	static std::pair<BigInt, BigInt> sqrt_rem(const BigInt& number);
+	static BigInt isqrt(const BigInt& number);
+	static std::pair<BigInt, BigInt> root_rem(const BigInt& number, uint32_t degree);
+	static BigInt iroot(const BigInt& number, uint32_t degree);
+	static bool is_perfect_power(const BigInt& number);
 
 	std::string to_string() const;
 	double to_double() const;
-	uint32_t BigInt::bit_length() const;
+	uint64_t bit_length() const;
+	bool test_bit(uint64_t index) const;
+	void set_bit(uint64_t index, bool value = true);
+	uint64_t popcount() const;
+	uint64_t count_trailing_zeros() const;
+	uint64_t extract_bits(uint64_t first, uint32_t count) const;
+	bool shares_chunks(const BigInt& other) const;
 
 	BigInt& operator =(const BigInt& other);
+	BigInt& operator =(BigInt&& other) noexcept;
 	BigInt& operator =(const std::string& number_str);
 	BigInt& operator +=(const BigInt& other);
 	BigInt& operator -=(const BigInt& other);
 	BigInt& operator *=(const BigInt& other);
 	BigInt& operator /=(const BigInt& other);
 	BigInt& operator %=(const BigInt& other);
-	BigInt& operator >>=(uint32_t shift);
-	BigInt& operator <<=(uint32_t shift);
+	BigInt& operator %=(const BarrettContext& context);
+	BigInt& operator >>=(uint64_t shift);
+	BigInt& operator <<=(uint64_t shift);
+	BigInt& operator &=(const BigInt& other);
+	BigInt& operator |=(const BigInt& other);
+	BigInt& operator ^=(const BigInt& other);
 
 	BigInt operator +(const BigInt& other) const;
 	BigInt operator -(const BigInt& other) const;
@@ -65,8 +151,13 @@ public:
 	BigInt operator *(const BigInt& other) const;
 	BigInt operator /(const BigInt& other) const;
 	BigInt operator %(const BigInt& other) const;
-	BigInt operator >>(uint32_t shift) const;
-	BigInt operator <<(uint32_t shift) const;
+	BigInt operator %(const BarrettContext& context) const;
+	BigInt operator >>(uint64_t shift) const;
+	BigInt operator <<(uint64_t shift) const;
+	BigInt operator &(const BigInt& other) const;
+	BigInt operator |(const BigInt& other) const;
+	BigInt operator ^(const BigInt& other) const;
+	BigInt operator ~() const;
 	
 	bool operator ==(const BigInt& other) const;
 	bool operator !=(const BigInt& other) const;
@@ -74,6 +165,154 @@ public:
 	bool operator <(const BigInt& other) const;
 	bool operator >=(const BigInt& other) const;
 	bool operator <=(const BigInt& other) const;
-	
+
+	template <typename T, BigIntScalar<T> = 0> BigInt& operator +=(T other);
+	template <typename T, BigIntScalar<T> = 0> BigInt& operator -=(T other);
+	template <typename T, BigIntScalar<T> = 0> BigInt& operator *=(T other);
+	template <typename T, BigIntScalar<T> = 0> BigInt& operator /=(T other);
+	template <typename T, BigIntScalar<T> = 0> BigInt& operator %=(T other);
+
+	template <typename T, BigIntScalar<T> = 0> BigInt operator +(T other) const;
+	template <typename T, BigIntScalar<T> = 0> BigInt operator -(T other) const;
+	template <typename T, BigIntScalar<T> = 0> BigInt operator *(T other) const;
+	template <typename T, BigIntScalar<T> = 0> BigInt operator /(T other) const;
+	template <typename T, BigIntScalar<T> = 0> BigInt operator %(T other) const;
+
+	template <typename T, BigIntScalar<T> = 0> bool operator ==(T other) const;
+	template <typename T, BigIntScalar<T> = 0> bool operator !=(T other) const;
+	template <typename T, BigIntScalar<T> = 0> bool operator >(T other) const;
+	template <typename T, BigIntScalar<T> = 0> bool operator <(T other) const;
+	template <typename T, BigIntScalar<T> = 0> bool operator >=(T other) const;
+	template <typename T, BigIntScalar<T> = 0> bool operator <=(T other) const;
+
 	friend std::ostream& operator <<(std::ostream& os, const BigInt& number);
-};
\ No newline at end of file
+
+	template <size_t Bits> friend class FixedBigUInt;
+	template <size_t Bits> friend class FixedBigInt;
+	friend class MontgomeryContext;
+	friend class BarrettContext;
+	friend class ReductionContext;
+	friend class FixedBaseExp;
+	friend class Primality;
+	friend class BigIntRandom;
+	friend class BigIntAccumulator;
+	friend class DiskBigInt;
+	friend class BigIntBatch;
+	friend class BatchMontgomeryContext;
+};
+
+template <typename T, BigIntScalar<T>>
+uint64_t BigInt::scalar_abs(T number) {
+	if constexpr (std::is_signed_v<T>)
+		return (number < 0) ? 0 - (uint64_t)number : (uint64_t)number;
+	else
+		return (uint64_t)number;
+}
+
+template <typename T, BigIntScalar<T>>
+bool BigInt::scalar_is_negative(T number) {
+	if constexpr (std::is_signed_v<T>)
+		return number < 0;
+	else
+		return false;
+}
+
+template <typename T, BigIntScalar<T>>
+BigInt& BigInt::operator +=(T other) {
+	*this = BigInt::sum_scalar(*this, scalar_abs(other), scalar_is_negative(other));
+	return *this;
+}
+
+template <typename T, BigIntScalar<T>>
+BigInt& BigInt::operator -=(T other) {
+	*this = BigInt::sub_scalar(*this, scalar_abs(other), scalar_is_negative(other));
+	return *this;
+}
+
+template <typename T, BigIntScalar<T>>
+BigInt& BigInt::operator *=(T other) {
+	*this = BigInt::mul_scalar(*this, scalar_abs(other), scalar_is_negative(other));
+	return *this;
+}
+
+template <typename T, BigIntScalar<T>>
+BigInt& BigInt::operator /=(T other) {
+	*this = BigInt::div_scalar(*this, scalar_abs(other), scalar_is_negative(other)).first;
+	return *this;
+}
+
+template <typename T, BigIntScalar<T>>
+BigInt& BigInt::operator %=(T other) {
+	*this = BigInt::from_scalar(BigInt::mod_scalar(*this, scalar_abs(other)));
+	return *this;
+}
+
+template <typename T, BigIntScalar<T>>
+BigInt BigInt::operator +(T other) const {
+	return BigInt::sum_scalar(*this, scalar_abs(other), scalar_is_negative(other));
+}
+
+template <typename T, BigIntScalar<T>>
+BigInt BigInt::operator -(T other) const {
+	return BigInt::sub_scalar(*this, scalar_abs(other), scalar_is_negative(other));
+}
+
+template <typename T, BigIntScalar<T>>
+BigInt BigInt::operator *(T other) const {
+	return BigInt::mul_scalar(*this, scalar_abs(other), scalar_is_negative(other));
+}
+
+template <typename T, BigIntScalar<T>>
+BigInt BigInt::operator /(T other) const {
+	return BigInt::div_scalar(*this, scalar_abs(other), scalar_is_negative(other)).first;
+}
+
+template <typename T, BigIntScalar<T>>
+BigInt BigInt::operator %(T other) const {
+	return BigInt::from_scalar(BigInt::mod_scalar(*this, scalar_abs(other)));
+}
+
+template <typename T, BigIntScalar<T>>
+bool BigInt::operator ==(T other) const {
+	return BigInt::cmp_scalar(*this, scalar_abs(other), scalar_is_negative(other)) == 0;
+}
+
+template <typename T, BigIntScalar<T>>
+bool BigInt::operator !=(T other) const {
+	return BigInt::cmp_scalar(*this, scalar_abs(other), scalar_is_negative(other)) != 0;
+}
+
+template <typename T, BigIntScalar<T>>
+bool BigInt::operator >(T other) const {
+	return BigInt::cmp_scalar(*this, scalar_abs(other), scalar_is_negative(other)) > 0;
+}
+
+template <typename T, BigIntScalar<T>>
+bool BigInt::operator <(T other) const {
+	return BigInt::cmp_scalar(*this, scalar_abs(other), scalar_is_negative(other)) < 0;
+}
+
+template <typename T, BigIntScalar<T>>
+bool BigInt::operator >=(T other) const {
+	return BigInt::cmp_scalar(*this, scalar_abs(other), scalar_is_negative(other)) >= 0;
+}
+
+template <typename T, BigIntScalar<T>>
+bool BigInt::operator <=(T other) const {
+	return BigInt::cmp_scalar(*this, scalar_abs(other), scalar_is_negative(other)) <= 0;
+}
+
+template <typename T, BigIntScalar<T> = 0>
+BigInt operator +(T lhs, const BigInt& rhs) {
+	return BigInt::sum_scalar(rhs, BigInt::scalar_abs(lhs), BigInt::scalar_is_negative(lhs));
+}
+
+template <typename T, BigIntScalar<T> = 0>
+BigInt operator -(T lhs, const BigInt& rhs) {
+	return BigInt::sum_scalar(-rhs, BigInt::scalar_abs(lhs), BigInt::scalar_is_negative(lhs));
+}
+
+template <typename T, BigIntScalar<T> = 0>
+BigInt operator *(T lhs, const BigInt& rhs) {
+	return BigInt::mul_scalar(rhs, BigInt::scalar_abs(lhs), BigInt::scalar_is_negative(lhs));
+}
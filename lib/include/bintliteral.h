@@ -0,0 +1,127 @@
+﻿#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include "bintlib.h"
+#include "bintfixed.h"
+
+class BigIntLiteral
+{
+public:
+	static constexpr uint32_t base(const char* digits, size_t length) {
+		if (length > 2 && digits[0] == '0' && (digits[1] == 'x' || digits[1] == 'X'))
+			return 16;
+		if (length > 2 && digits[0] == '0' && (digits[1] == 'b' || digits[1] == 'B'))
+			return 2;
+		if (length > 1 && digits[0] == '0')
+			return 8;
+		return 10;
+	}
+
+	static constexpr size_t prefix_length(const char* digits, size_t length) {
+		uint32_t number_base = base(digits, length);
+		if (number_base == 16 || number_base == 2)
+			return 2;
+		if (number_base == 8)
+			return 1;
+		return 0;
+	}
+
+	static constexpr uint32_t digit(char symbol, uint32_t number_base) {
+		uint32_t value = 0;
+		if (symbol >= '0' && symbol <= '9')
+			value = (uint32_t)(symbol - '0');
+		else if (symbol >= 'a' && symbol <= 'f')
+			value = (uint32_t)(symbol - 'a' + 10);
+		else if (symbol >= 'A' && symbol <= 'F')
+			value = (uint32_t)(symbol - 'A' + 10);
+		else
+			throw std::invalid_argument("Error parsing big number literal");
+
+		if (value >= number_base)
+			throw std::invalid_argument("Error parsing big number literal");
+		return value;
+	}
+
+	static constexpr size_t chunk_count(const char* digits, size_t length) {
+		uint32_t number_base = base(digits, length);
+		size_t bits_per_digit = (number_base == 8) ? 3 : (number_base == 2) ? 1 : 4;
+		return (length * bits_per_digit) / 32 + 1;
+	}
+
+	template <size_t Size>
+	static constexpr std::array<uint32_t, Size> parse(const char* digits, size_t length) {
+		std::array<uint32_t, Size> chunks{};
+		uint32_t number_base = base(digits, length);
+		size_t used = 1;
+
+		uint64_t group = 0;
+		uint64_t multiplier = 1;
+		for (size_t i = prefix_length(digits, length); i <= length; i++) {
+			if (i < length) {
+				if (digits[i] == '\'')
+					continue;
+
+				group = group * number_base + digit(digits[i], number_base);
+				multiplier *= number_base;
+				if (multiplier <= UINT32_MAX / number_base)
+					continue;
+			}
+
+			uint64_t carry = group;
+			for (size_t j = 0; j < used; j++) {
+				uint64_t value = (uint64_t)chunks[j] * multiplier + carry;
+				chunks[j] = (uint32_t)value;
+				carry = value >> 32;
+			}
+			if (carry != 0) {
+				if (used == Size)
+					throw std::invalid_argument("Big number literal is too long");
+				chunks[used++] = (uint32_t)carry;
+			}
+
+			group = 0;
+			multiplier = 1;
+		}
+
+		return chunks;
+	}
+
+	template <size_t Size>
+	static constexpr size_t significant(const std::array<uint32_t, Size>& chunks) {
+		size_t size = Size;
+		while (size > 1 && chunks[size - 1] == 0)
+			size--;
+		return size;
+	}
+
+	template <size_t Size, size_t ParsedSize>
+	static constexpr std::array<uint32_t, Size> trim(const std::array<uint32_t, ParsedSize>& chunks) {
+		std::array<uint32_t, Size> result{};
+		for (size_t i = 0; i < Size; i++)
+			result[i] = chunks[i];
+		return result;
+	}
+};
+
+template <char... Digits>
+struct BigIntLiteralChunks
+{
+	static constexpr char digits[] = { Digits... };
+	static constexpr size_t length = sizeof...(Digits);
+	static constexpr auto parsed = BigIntLiteral::parse<BigIntLiteral::chunk_count(digits, length)>(digits, length);
+	static constexpr size_t size = BigIntLiteral::significant(parsed);
+	static constexpr std::array<uint32_t, size> chunks = BigIntLiteral::trim<size>(parsed);
+};
+
+template <char... Digits>
+BigInt operator ""_bi() {
+	constexpr const auto& chunks = BigIntLiteralChunks<Digits...>::chunks;
+	return BigInt(std::vector<uint32_t>(chunks.begin(), chunks.end()));
+}
+
+template <char... Digits>
+constexpr FixedBigUInt<32 * BigIntLiteralChunks<Digits...>::size> operator ""_fbi() {
+	return FixedBigUInt<32 * BigIntLiteralChunks<Digits...>::size>(BigIntLiteralChunks<Digits...>::chunks);
+}
@@ -0,0 +1,130 @@
+﻿#pragma once
+
+#include <memory>
+#include <optional>
+#include "bintlib.h"
+
+class MontgomeryContext
+{
+private:
+	BigInt _module;
+	size_t _size;
+	uint32_t _m_inv;
+	BigInt _r1;
+	BigInt _r2;
+public:
+	explicit MontgomeryContext(const BigInt& module);
+
+	const BigInt& module() const;
+	size_t size() const;
+	const BigInt& one() const;
+
+	BigInt reduce(const BigInt& number) const;
+	BigInt to_montgomery(const BigInt& number) const;
+	BigInt from_montgomery(const BigInt& number) const;
+
+	BigInt add(const BigInt& lhs, const BigInt& rhs) const;
+	BigInt sub(const BigInt& lhs, const BigInt& rhs) const;
+	BigInt mul(const BigInt& lhs, const BigInt& rhs) const;
+	BigInt sqr(const BigInt& number) const;
+	BigInt pow(const BigInt& number, const BigInt& degree, uint32_t base = 16) const;
+};
+
+class BarrettContext
+{
+private:
+	BigInt _module;
+	size_t _size;
+	BigInt _mu;
+public:
+	explicit BarrettContext(const BigInt& module);
+
+	const BigInt& module() const;
+	size_t size() const;
+
+	BigInt reduce(const BigInt& number) const;
+	BigInt mul(const BigInt& lhs, const BigInt& rhs) const;
+	BigInt sqr(const BigInt& number) const;
+	BigInt pow(const BigInt& number, const BigInt& degree, uint32_t base = 16) const;
+};
+
+class FixedBaseExp
+{
+private:
+	MontgomeryContext _context;
+	BigInt _number;
+	uint64_t _max_bits;
+	uint32_t _window;
+	std::vector<BigInt> _table;
+public:
+	FixedBaseExp(const BigInt& number, const BigInt& module, uint64_t max_bits, uint32_t window = 4);
+
+	const MontgomeryContext& context() const;
+	uint64_t max_bits() const;
+	uint32_t window() const;
+	size_t table_size() const;
+
+	BigInt pow(const BigInt& degree) const;
+};
+
+class ReductionContext
+{
+public:
+	enum class Form { barrett, pseudo_mersenne, solinas };
+private:
+	BigInt _module;
+	Form _form;
+	uint64_t _bits;
+	uint32_t _c;
+	bool _c_negative;
+	std::vector<std::pair<uint64_t, bool>> _terms;
+	std::optional<BarrettContext> _barrett;
+
+	static void split(const BigInt& number, uint64_t bits, BigInt& high, BigInt& low);
+	bool detect(uint64_t bits, const BigInt& c, bool c_negative, size_t max_terms);
+public:
+	explicit ReductionContext(const BigInt& module, size_t max_terms = 8);
+
+	const BigInt& module() const;
+	Form form() const;
+
+	BigInt reduce(const BigInt& number) const;
+	BigInt mul(const BigInt& lhs, const BigInt& rhs) const;
+	BigInt sqr(const BigInt& number) const;
+	BigInt pow(const BigInt& number, const BigInt& degree, uint32_t base = 16) const;
+};
+
+class ModInt
+{
+private:
+	std::shared_ptr<const MontgomeryContext> _context;
+	BigInt _value;
+
+	ModInt(const std::shared_ptr<const MontgomeryContext>& context, const BigInt& value, bool is_montgomery);
+	void check_context(const ModInt& other) const;
+public:
+	ModInt(const std::shared_ptr<const MontgomeryContext>& context, const BigInt& number = 0);
+
+	static ModInt from_montgomery(const std::shared_ptr<const MontgomeryContext>& context, const BigInt& value);
+
+	const std::shared_ptr<const MontgomeryContext>& context() const;
+	const BigInt& montgomery_value() const;
+	BigInt value() const;
+
+	ModInt pow(const BigInt& degree) const;
+	ModInt inverse() const;
+
+	ModInt& operator +=(const ModInt& other);
+	ModInt& operator -=(const ModInt& other);
+	ModInt& operator *=(const ModInt& other);
+
+	ModInt operator +(const ModInt& other) const;
+	ModInt operator -(const ModInt& other) const;
+	ModInt operator -() const;
+	ModInt operator *(const ModInt& other) const;
+
+	bool operator ==(const ModInt& other) const;
+	bool operator !=(const ModInt& other) const;
+
+	friend std::ostream& operator <<(std::ostream& os, const ModInt& number);
+};
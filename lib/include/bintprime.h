@@ -0,0 +1,28 @@
+﻿#pragma once
+
+#include "bintmod.h"
+
+class Primality
+{
+private:
+	static const std::vector<uint32_t>& small_primes();
+	static const std::vector<std::pair<uint64_t, size_t>>& small_prime_groups();
+	static bool is_square(const BigInt& number);
+	static bool miller_rabin_witness(const MontgomeryContext& context, const BigInt& witness, const BigInt& odd_part, uint64_t two_power);
+public:
+	static const uint32_t SIEVE_LIMIT = 1 << 16;
+	static const uint32_t TRIAL_DIVISION_BOUND = 1 << 12;
+	static const size_t SIEVE_WINDOW = 1 << 12;
+
+	static std::vector<uint32_t> sieve(uint64_t limit);
+	static uint32_t trial_division(const BigInt& number, uint32_t bound = TRIAL_DIVISION_BOUND);
+	static int jacobi(const BigInt& a, const BigInt& n);
+
+	static bool miller_rabin(const BigInt& number, const std::vector<BigInt>& witnesses);
+	static bool miller_rabin(const BigInt& number, size_t rounds, uint64_t seed = 0);
+	static bool strong_lucas(const BigInt& number);
+	static bool bpsw(const BigInt& number);
+	static bool is_probable_prime(const BigInt& number, size_t rounds = 0);
+
+	static BigInt random_prime(uint64_t bits, uint64_t seed, size_t threads = 0);
+};
@@ -0,0 +1,31 @@
+﻿#pragma once
+
+#include <functional>
+#include "bintlib.h"
+
+class BigIntRandom
+{
+private:
+	uint64_t _state[4];
+
+	static uint64_t splitmix64(uint64_t& state);
+	void fill(ChunkBuffer& chunks, uint64_t bits);
+public:
+	using result_type = uint64_t;
+	using EntropySource = std::function<uint64_t()>;
+
+	explicit BigIntRandom(uint64_t seed = 0);
+	explicit BigIntRandom(const EntropySource& entropy);
+
+	void seed(uint64_t seed);
+	void seed(const EntropySource& entropy);
+
+	static constexpr result_type min() { return 0; }
+	static constexpr result_type max() { return UINT64_MAX; }
+	result_type operator ()();
+
+	BigInt bits(uint64_t bits);
+	BigInt exact_bits(uint64_t bits);
+	BigInt below(const BigInt& bound);
+	BigInt range(const BigInt& low, const BigInt& high);
+};
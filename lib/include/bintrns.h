@@ -0,0 +1,105 @@
+﻿#pragma once
+
+#include <memory>
+#include "bintlib.h"
+
+class RnsBase
+{
+private:
+	std::vector<uint32_t> _moduli;
+	std::vector<uint32_t> _shifts;
+	std::vector<uint32_t> _reciprocals;
+	BigInt _product;
+	std::vector<BigInt> _cofactors;
+	std::vector<uint32_t> _cofactor_inverses;
+	std::vector<std::vector<uint32_t>> _mixed_radix_inverses;
+public:
+	explicit RnsBase(const std::vector<uint32_t>& moduli);
+
+	static uint32_t inverse(uint32_t number, uint32_t module);
+	static std::vector<uint32_t> word_primes(size_t count, uint32_t below = UINT32_MAX);
+	static RnsBase generate(size_t count, uint32_t below = UINT32_MAX);
+
+	size_t size() const;
+	const std::vector<uint32_t>& moduli() const;
+	const BigInt& product() const;
+	const BigInt& cofactor(size_t channel) const;
+	uint32_t cofactor_inverse(size_t channel) const;
+
+	uint32_t add(uint32_t lhs, uint32_t rhs, size_t channel) const;
+	uint32_t sub(uint32_t lhs, uint32_t rhs, size_t channel) const;
+	uint32_t mul(uint32_t lhs, uint32_t rhs, size_t channel) const;
+
+	std::vector<uint32_t> add(const std::vector<uint32_t>& lhs, const std::vector<uint32_t>& rhs) const;
+	std::vector<uint32_t> sub(const std::vector<uint32_t>& lhs, const std::vector<uint32_t>& rhs) const;
+	std::vector<uint32_t> mul(const std::vector<uint32_t>& lhs, const std::vector<uint32_t>& rhs) const;
+
+	std::vector<uint32_t> to_residues(const BigInt& number) const;
+	BigInt from_residues(const std::vector<uint32_t>& residues) const;
+	std::vector<uint32_t> mixed_radix_digits(const std::vector<uint32_t>& residues) const;
+	BigInt from_mixed_radix(const std::vector<uint32_t>& residues) const;
+};
+
+class RnsInt
+{
+private:
+	std::shared_ptr<const RnsBase> _base;
+	std::vector<uint32_t> _residues;
+
+	RnsInt(const std::shared_ptr<const RnsBase>& base, std::vector<uint32_t>&& residues);
+	void check_base(const RnsInt& other) const;
+public:
+	RnsInt(const std::shared_ptr<const RnsBase>& base, const BigInt& number = 0);
+
+	static RnsInt from_residues(const std::shared_ptr<const RnsBase>& base, const std::vector<uint32_t>& residues);
+
+	const std::shared_ptr<const RnsBase>& base() const;
+	const std::vector<uint32_t>& residues() const;
+	BigInt value() const;
+	BigInt signed_value() const;
+
+	RnsInt& operator +=(const RnsInt& other);
+	RnsInt& operator -=(const RnsInt& other);
+	RnsInt& operator *=(const RnsInt& other);
+
+	RnsInt operator +(const RnsInt& other) const;
+	RnsInt operator -(const RnsInt& other) const;
+	RnsInt operator -() const;
+	RnsInt operator *(const RnsInt& other) const;
+
+	bool operator ==(const RnsInt& other) const;
+	bool operator !=(const RnsInt& other) const;
+
+	friend std::ostream& operator <<(std::ostream& os, const RnsInt& number);
+};
+
+class RnsMontgomeryContext
+{
+private:
+	BigInt _module;
+	RnsBase _base;
+	RnsBase _extension;
+	std::vector<uint32_t> _quotient_factors;
+	std::vector<std::vector<uint32_t>> _base_to_extension;
+	std::vector<uint32_t> _module_residues;
+	std::vector<uint32_t> _base_inverses;
+	std::vector<std::vector<uint32_t>> _extension_to_base;
+	std::vector<uint32_t> _extension_product_residues;
+	std::vector<uint32_t> _one;
+
+	RnsMontgomeryContext(const BigInt& module, const std::vector<uint32_t>& primes);
+public:
+	explicit RnsMontgomeryContext(const BigInt& module);
+
+	const BigInt& module() const;
+	const RnsBase& base() const;
+	const RnsBase& extension() const;
+	const std::vector<uint32_t>& one() const;
+
+	std::vector<uint32_t> to_montgomery(const BigInt& number) const;
+	BigInt from_montgomery(const std::vector<uint32_t>& residues) const;
+
+	std::vector<uint32_t> mul(const std::vector<uint32_t>& lhs, const std::vector<uint32_t>& rhs) const;
+	std::vector<uint32_t> pow(const std::vector<uint32_t>& number, const BigInt& degree) const;
+	BigInt pow(const BigInt& number, const BigInt& degree) const;
+};
@@ -0,0 +1,25 @@
+﻿#pragma once
+
+#include "bintmod.h"
+
+class RsaCrtContext
+{
+private:
+	BigInt _p;
+	BigInt _q;
+	BigInt _module;
+	BigInt _dp;
+	BigInt _dq;
+	BigInt _q_inv;
+	MontgomeryContext _p_context;
+	MontgomeryContext _q_context;
+	bool _parallel;
+public:
+	RsaCrtContext(const BigInt& p, const BigInt& q, const BigInt& exponent, bool parallel = false);
+
+	const BigInt& module() const;
+	bool parallel() const;
+	void set_parallel(bool parallel);
+
+	BigInt pow(const BigInt& number) const;
+};
@@ -0,0 +1,24 @@
+﻿#pragma once
+
+#include "bintlib.h"
+
+class ProductTree
+{
+private:
+	std::vector<std::vector<BigInt>> _levels;
+	size_t _threads;
+
+	std::vector<BigInt> descend(const BigInt& number, bool squared) const;
+public:
+	explicit ProductTree(const std::vector<BigInt>& numbers, size_t threads = 1);
+
+	size_t size() const;
+	size_t depth() const;
+	const BigInt& root() const;
+	const std::vector<BigInt>& level(size_t index) const;
+
+	std::vector<BigInt> remainders(const BigInt& number) const;
+
+	static std::vector<BigInt> remainders(const BigInt& number, const std::vector<BigInt>& moduli, size_t threads = 1);
+	static std::vector<BigInt> batch_gcd(const std::vector<BigInt>& moduli, size_t threads = 1, size_t batch_size = 0);
+};
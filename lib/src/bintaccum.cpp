@@ -0,0 +1,133 @@
+﻿#include <bintaccum.h>
+
+BigIntAccumulator::BigIntAccumulator(size_t capacity) : _pending(0) {
+	_positive.reserve(capacity);
+	_negative.reserve(capacity);
+}
+
+void BigIntAccumulator::normalize(std::vector<uint64_t>& sums) {
+	uint64_t carry = 0;
+	for (uint64_t& sum : sums) {
+		uint64_t value = sum + carry;
+		sum = (uint32_t)value;
+		carry = value >> 32;
+	}
+
+	while (carry != 0) {
+		sums.push_back((uint32_t)carry);
+		carry >>= 32;
+	}
+}
+
+BigInt BigIntAccumulator::to_bigint(const std::vector<uint64_t>& sums) {
+	std::vector<uint32_t> chunks(sums.begin(), sums.end());
+	while (chunks.size() > 1 && chunks.back() == 0)
+		chunks.pop_back();
+	if (chunks.empty())
+		chunks.push_back(0);
+
+	return BigInt(chunks);
+}
+
+void BigIntAccumulator::reserve(uint64_t count) {
+	if (_pending + count > MAX_PENDING) {
+		BigIntAccumulator::normalize(_positive);
+		BigIntAccumulator::normalize(_negative);
+		_pending = 0;
+	}
+	_pending += count;
+}
+
+void BigIntAccumulator::accumulate(std::vector<uint64_t>& sums, const ChunkBuffer& chunks) {
+	reserve(1);
+	if (sums.size() < chunks.size())
+		sums.resize(chunks.size(), 0);
+
+	uint64_t* target = sums.data() + chunks.offset();
+	const uint32_t* source = chunks.stored().data();
+	for (size_t i = 0; i < chunks.stored().size(); ++i)
+		target[i] += source[i];
+}
+
+void BigIntAccumulator::accumulate_scalar(uint64_t number, bool is_negative) {
+	std::vector<uint64_t>& sums = is_negative ? _negative : _positive;
+	reserve(1);
+	if (sums.size() < 2)
+		sums.resize(2, 0);
+
+	sums[0] += (uint32_t)number;
+	sums[1] += number >> 32;
+}
+
+void BigIntAccumulator::accumulate_product(const BigInt& lhs, const BigInt& rhs, bool is_negative) {
+	std::vector<uint64_t>& sums = is_negative ? _negative : _positive;
+	const ChunkBuffer& a_chunks = lhs._chunks.size() >= rhs._chunks.size() ? lhs._chunks : rhs._chunks;
+	const ChunkBuffer& b_chunks = lhs._chunks.size() >= rhs._chunks.size() ? rhs._chunks : lhs._chunks;
+	const std::vector<uint32_t>& a = a_chunks.stored();
+	const std::vector<uint32_t>& b = b_chunks.stored();
+
+	if (b.size() > BigInt::MUL_KARATSUBA_THRESHOLD) {
+		accumulate(sums, BigInt::karatsuba_mul(lhs, rhs)._chunks);
+		return;
+	}
+
+	reserve(2 * b.size());
+	if (sums.size() < a_chunks.size() + b_chunks.size())
+		sums.resize(a_chunks.size() + b_chunks.size(), 0);
+
+	for (size_t j = 0; j < b.size(); ++j) {
+		uint64_t* target = sums.data() + a_chunks.offset() + b_chunks.offset() + j;
+		uint64_t multiplier = b[j];
+		for (size_t i = 0; i < a.size(); ++i) {
+			uint64_t product = a[i] * multiplier;
+			target[i] += (uint32_t)product;
+			target[i + 1] += product >> 32;
+		}
+	}
+}
+
+void BigIntAccumulator::clear() {
+	_positive.clear();
+	_negative.clear();
+	_pending = 0;
+}
+
+size_t BigIntAccumulator::size() const {
+	return std::max(_positive.size(), _negative.size());
+}
+
+BigIntAccumulator& BigIntAccumulator::add(const BigInt& number) {
+	accumulate(number._is_negative ? _negative : _positive, number._chunks);
+	return *this;
+}
+
+BigIntAccumulator& BigIntAccumulator::sub(const BigInt& number) {
+	accumulate(number._is_negative ? _positive : _negative, number._chunks);
+	return *this;
+}
+
+BigIntAccumulator& BigIntAccumulator::addmul(const BigInt& lhs, const BigInt& rhs) {
+	accumulate_product(lhs, rhs, lhs._is_negative ^ rhs._is_negative);
+	return *this;
+}
+
+BigIntAccumulator& BigIntAccumulator::submul(const BigInt& lhs, const BigInt& rhs) {
+	accumulate_product(lhs, rhs, !(lhs._is_negative ^ rhs._is_negative));
+	return *this;
+}
+
+BigInt BigIntAccumulator::result() {
+	BigIntAccumulator::normalize(_positive);
+	BigIntAccumulator::normalize(_negative);
+	_pending = 0;
+
+	return BigIntAccumulator::to_bigint(_positive) - BigIntAccumulator::to_bigint(_negative);
+}
+
+BigIntAccumulator& BigIntAccumulator::operator +=(const BigInt& number) {
+	return add(number);
+}
+
+BigIntAccumulator& BigIntAccumulator::operator -=(const BigInt& number) {
+	return sub(number);
+}
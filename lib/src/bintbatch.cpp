@@ -0,0 +1,357 @@
+﻿#include <bintbatch.h>
+
+static void add_tile(const uint32_t* lhs, const uint32_t* rhs, uint32_t* result, size_t stride, size_t lanes, size_t limbs, uint64_t* carry) {
+	std::fill(carry, carry + lanes, 0);
+	for (size_t k = 0; k < limbs; ++k) {
+		const uint32_t* a = lhs + k * stride;
+		const uint32_t* b = rhs + k * stride;
+		uint32_t* r = result + k * stride;
+		for (size_t j = 0; j < lanes; ++j) {
+			uint64_t value = (uint64_t)a[j] + b[j] + carry[j];
+			r[j] = (uint32_t)value;
+			carry[j] = value >> 32;
+		}
+	}
+}
+
+static void sub_tile(const uint32_t* lhs, const uint32_t* rhs, uint32_t* result, size_t stride, size_t lanes, size_t limbs, uint64_t* borrow) {
+	std::fill(borrow, borrow + lanes, 0);
+	for (size_t k = 0; k < limbs; ++k) {
+		const uint32_t* a = lhs + k * stride;
+		const uint32_t* b = rhs + k * stride;
+		uint32_t* r = result + k * stride;
+		for (size_t j = 0; j < lanes; ++j) {
+			uint64_t value = (uint64_t)a[j] - b[j] - borrow[j];
+			r[j] = (uint32_t)value;
+			borrow[j] = value >> 63;
+		}
+	}
+}
+
+static void mul_tile(const uint32_t* lhs, const uint32_t* rhs, uint32_t* result, size_t stride, size_t lanes, size_t limbs, uint64_t* t, uint64_t* carry) {
+	std::fill(t, t + 2 * limbs * lanes, 0);
+	for (size_t i = 0; i < limbs; ++i) {
+		const uint32_t* a = lhs + i * stride;
+		std::fill(carry, carry + lanes, 0);
+		for (size_t k = 0; k < limbs; ++k) {
+			const uint32_t* b = rhs + k * stride;
+			uint64_t* tk = t + (i + k) * lanes;
+			for (size_t j = 0; j < lanes; ++j) {
+				uint64_t value = tk[j] + (uint64_t)a[j] * b[j] + carry[j];
+				tk[j] = (uint32_t)value;
+				carry[j] = value >> 32;
+			}
+		}
+		uint64_t* top = t + (i + limbs) * lanes;
+		for (size_t j = 0; j < lanes; ++j)
+			top[j] = carry[j];
+	}
+
+	for (size_t k = 0; k < 2 * limbs; ++k) {
+		uint32_t* r = result + k * stride;
+		const uint64_t* tk = t + k * lanes;
+		for (size_t j = 0; j < lanes; ++j)
+			r[j] = (uint32_t)tk[j];
+	}
+}
+
+static void montgomery_tile(const uint32_t* lhs, const uint32_t* rhs, uint32_t* result, size_t stride, size_t lanes, size_t limbs, const uint32_t* module, uint32_t m_inv, uint64_t* t, uint64_t* carry, uint64_t* m) {
+	std::fill(t, t + (limbs + 2) * lanes, 0);
+	uint64_t* t0 = t;
+	uint64_t* ts = t + limbs * lanes;
+	uint64_t* ts1 = t + (limbs + 1) * lanes;
+
+	for (size_t i = 0; i < limbs; ++i) {
+		const uint32_t* a = lhs + i * stride;
+		std::fill(carry, carry + lanes, 0);
+		for (size_t k = 0; k < limbs; ++k) {
+			const uint32_t* b = rhs + k * stride;
+			uint64_t* tk = t + k * lanes;
+			for (size_t j = 0; j < lanes; ++j) {
+				uint64_t value = tk[j] + (uint64_t)a[j] * b[j] + carry[j];
+				tk[j] = (uint32_t)value;
+				carry[j] = value >> 32;
+			}
+		}
+		for (size_t j = 0; j < lanes; ++j) {
+			uint64_t value = ts[j] + carry[j];
+			ts[j] = (uint32_t)value;
+			ts1[j] = value >> 32;
+		}
+
+		for (size_t j = 0; j < lanes; ++j) {
+			m[j] = (uint32_t)((uint32_t)t0[j] * m_inv);
+			carry[j] = (t0[j] + m[j] * module[0]) >> 32;
+		}
+		for (size_t k = 1; k < limbs; ++k) {
+			uint64_t* tk = t + k * lanes;
+			uint64_t* tk1 = t + (k - 1) * lanes;
+			uint64_t n = module[k];
+			for (size_t j = 0; j < lanes; ++j) {
+				uint64_t value = tk[j] + m[j] * n + carry[j];
+				tk1[j] = (uint32_t)value;
+				carry[j] = value >> 32;
+			}
+		}
+		uint64_t* tl = t + (limbs - 1) * lanes;
+		for (size_t j = 0; j < lanes; ++j) {
+			uint64_t value = ts[j] + carry[j];
+			tl[j] = (uint32_t)value;
+			ts[j] = ts1[j] + (value >> 32);
+		}
+	}
+
+	std::fill(carry, carry + lanes, 0);
+	for (size_t k = 0; k < limbs; ++k) {
+		const uint64_t* tk = t + k * lanes;
+		uint32_t* r = result + k * stride;
+		uint64_t n = module[k];
+		for (size_t j = 0; j < lanes; ++j) {
+			uint64_t value = tk[j] - n - carry[j];
+			r[j] = (uint32_t)value;
+			carry[j] = value >> 63;
+		}
+	}
+	for (size_t k = 0; k < limbs; ++k) {
+		const uint64_t* tk = t + k * lanes;
+		uint32_t* r = result + k * stride;
+		for (size_t j = 0; j < lanes; ++j)
+			r[j] = (ts[j] == 0 && carry[j] != 0) ? (uint32_t)tk[j] : r[j];
+	}
+}
+
+BigIntBatch::BigIntBatch(size_t count, size_t limbs) : _count(count), _limbs(limbs), _data(count * limbs, 0) {
+	if (limbs == 0)
+		throw std::invalid_argument("Batch numbers must have at least one limb");
+}
+
+void BigIntBatch::check_shape(const BigIntBatch& other) const {
+	if (_count != other._count || _limbs != other._limbs)
+		throw std::invalid_argument("Batches must have the same shape");
+}
+
+void BigIntBatch::check_number(const BigInt& number) const {
+	if (number < 0 || number._chunks.size() > _limbs)
+		throw std::invalid_argument("Number does not fit into the batch");
+}
+
+BigIntBatch BigIntBatch::gather(const std::vector<BigInt>& numbers, size_t limbs) {
+	BigIntBatch batch(numbers.size(), limbs);
+	for (size_t j = 0; j < numbers.size(); ++j)
+		batch.set(j, numbers[j]);
+	return batch;
+}
+
+BigIntBatch BigIntBatch::broadcast(const BigInt& number, size_t count, size_t limbs) {
+	BigIntBatch batch(count, limbs);
+	batch.check_number(number);
+	for (size_t k = 0; k < number._chunks.size(); ++k)
+		std::fill(batch.limb(k), batch.limb(k) + count, number._chunks[k]);
+	return batch;
+}
+
+std::vector<BigInt> BigIntBatch::scatter() const {
+	std::vector<BigInt> numbers;
+	numbers.reserve(_count);
+	for (size_t j = 0; j < _count; ++j)
+		numbers.push_back(get(j));
+	return numbers;
+}
+
+size_t BigIntBatch::count() const {
+	return _count;
+}
+
+size_t BigIntBatch::limbs() const {
+	return _limbs;
+}
+
+const uint32_t* BigIntBatch::limb(size_t index) const {
+	return _data.data() + index * _count;
+}
+
+uint32_t* BigIntBatch::limb(size_t index) {
+	return _data.data() + index * _count;
+}
+
+BigInt BigIntBatch::get(size_t index) const {
+	if (index >= _count)
+		throw std::invalid_argument("Batch index out of range");
+
+	std::vector<uint32_t> chunks(_limbs);
+	for (size_t k = 0; k < _limbs; ++k)
+		chunks[k] = _data[k * _count + index];
+	while (chunks.size() > 1 && chunks.back() == 0)
+		chunks.pop_back();
+
+	return BigInt(chunks);
+}
+
+void BigIntBatch::set(size_t index, const BigInt& number) {
+	if (index >= _count)
+		throw std::invalid_argument("Batch index out of range");
+	check_number(number);
+
+	for (size_t k = 0; k < _limbs; ++k)
+		_data[k * _count + index] = k < number._chunks.size() ? number._chunks[k] : 0;
+}
+
+BigIntBatch BigIntBatch::add(const BigIntBatch& lhs, const BigIntBatch& rhs) {
+	lhs.check_shape(rhs);
+	BigIntBatch result(lhs._count, lhs._limbs);
+	std::vector<uint64_t> carry(TILE);
+	for (size_t first = 0; first < lhs._count; first += TILE)
+		add_tile(lhs.limb(0) + first, rhs.limb(0) + first, result.limb(0) + first, lhs._count, std::min(TILE, lhs._count - first), lhs._limbs, carry.data());
+	return result;
+}
+
+BigIntBatch BigIntBatch::sub(const BigIntBatch& lhs, const BigIntBatch& rhs) {
+	lhs.check_shape(rhs);
+	BigIntBatch result(lhs._count, lhs._limbs);
+	std::vector<uint64_t> borrow(TILE);
+	for (size_t first = 0; first < lhs._count; first += TILE)
+		sub_tile(lhs.limb(0) + first, rhs.limb(0) + first, result.limb(0) + first, lhs._count, std::min(TILE, lhs._count - first), lhs._limbs, borrow.data());
+	return result;
+}
+
+BigIntBatch BigIntBatch::mul(const BigIntBatch& lhs, const BigIntBatch& rhs) {
+	lhs.check_shape(rhs);
+	BigIntBatch result(lhs._count, 2 * lhs._limbs);
+	std::vector<uint64_t> t(2 * lhs._limbs * TILE);
+	std::vector<uint64_t> carry(TILE);
+	for (size_t first = 0; first < lhs._count; first += TILE)
+		mul_tile(lhs.limb(0) + first, rhs.limb(0) + first, result.limb(0) + first, lhs._count, std::min(TILE, lhs._count - first), lhs._limbs, t.data(), carry.data());
+	return result;
+}
+
+bool BigIntBatch::operator ==(const BigIntBatch& other) const {
+	return _count == other._count && _limbs == other._limbs && _data == other._data;
+}
+
+bool BigIntBatch::operator !=(const BigIntBatch& other) const {
+	return !(*this == other);
+}
+
+BatchMontgomeryContext::BatchMontgomeryContext(const BigInt& module) : _module(module), _limbs(module._chunks.size()), _module_limbs(module._chunks.begin(), module._chunks.end()), _m_inv(0) {
+	if (module <= 1 || (module._chunks[0] & 1) == 0)
+		throw std::invalid_argument("Module must be odd and greater than one");
+
+	uint32_t inv = module._chunks[0];
+	for (size_t i = 0; i < 4; i++)
+		inv *= 2 - module._chunks[0] * inv;
+	_m_inv = 0 - inv;
+
+	BigInt one = 1;
+	_r1 = (one << (uint64_t)(32 * _limbs)) % module;
+	_r2 = BigInt::karatsuba_square(_r1) % module;
+}
+
+void BatchMontgomeryContext::check_batch(const BigIntBatch& batch) const {
+	if (batch.limbs() != _limbs)
+		throw std::invalid_argument("Batch limbs do not match the module");
+}
+
+const BigInt& BatchMontgomeryContext::module() const {
+	return _module;
+}
+
+size_t BatchMontgomeryContext::limbs() const {
+	return _limbs;
+}
+
+BigIntBatch BatchMontgomeryContext::gather(const std::vector<BigInt>& numbers) const {
+	std::vector<BigInt> reduced;
+	reduced.reserve(numbers.size());
+	for (auto& number : numbers)
+		reduced.push_back(number >= 0 && number < _module ? number : number % _module);
+	return BigIntBatch::gather(reduced, _limbs);
+}
+
+BigIntBatch BatchMontgomeryContext::to_montgomery(const BigIntBatch& numbers) const {
+	return mul(numbers, BigIntBatch::broadcast(_r2, numbers.count(), _limbs));
+}
+
+BigIntBatch BatchMontgomeryContext::from_montgomery(const BigIntBatch& numbers) const {
+	return mul(numbers, BigIntBatch::broadcast(1, numbers.count(), _limbs));
+}
+
+BigIntBatch BatchMontgomeryContext::add(const BigIntBatch& lhs, const BigIntBatch& rhs) const {
+	check_batch(lhs);
+	lhs.check_shape(rhs);
+	BigIntBatch sum(lhs.count(), _limbs + 1);
+	BigIntBatch module = BigIntBatch::broadcast(_module, lhs.count(), _limbs + 1);
+	BigIntBatch result(lhs.count(), _limbs);
+	std::vector<uint64_t> carry(BigIntBatch::TILE);
+	std::vector<uint64_t> borrow(BigIntBatch::TILE);
+
+	for (size_t first = 0; first < lhs.count(); first += BigIntBatch::TILE) {
+		size_t lanes = std::min(BigIntBatch::TILE, lhs.count() - first);
+		add_tile(lhs.limb(0) + first, rhs.limb(0) + first, sum.limb(0) + first, lhs.count(), lanes, _limbs, carry.data());
+		for (size_t j = 0; j < lanes; ++j)
+			sum.limb(_limbs)[first + j] = (uint32_t)carry[j];
+		sub_tile(sum.limb(0) + first, module.limb(0) + first, module.limb(0) + first, lhs.count(), lanes, _limbs + 1, borrow.data());
+		for (size_t k = 0; k < _limbs; ++k) {
+			const uint32_t* s = sum.limb(k) + first;
+			const uint32_t* d = module.limb(k) + first;
+			uint32_t* r = result.limb(k) + first;
+			for (size_t j = 0; j < lanes; ++j)
+				r[j] = borrow[j] != 0 ? s[j] : d[j];
+		}
+	}
+
+	return result;
+}
+
+BigIntBatch BatchMontgomeryContext::sub(const BigIntBatch& lhs, const BigIntBatch& rhs) const {
+	check_batch(lhs);
+	lhs.check_shape(rhs);
+	BigIntBatch difference(lhs.count(), _limbs);
+	BigIntBatch module = BigIntBatch::broadcast(_module, lhs.count(), _limbs);
+	BigIntBatch result(lhs.count(), _limbs);
+	std::vector<uint64_t> borrow(BigIntBatch::TILE);
+	std::vector<uint64_t> carry(BigIntBatch::TILE);
+
+	for (size_t first = 0; first < lhs.count(); first += BigIntBatch::TILE) {
+		size_t lanes = std::min(BigIntBatch::TILE, lhs.count() - first);
+		sub_tile(lhs.limb(0) + first, rhs.limb(0) + first, difference.limb(0) + first, lhs.count(), lanes, _limbs, borrow.data());
+		add_tile(difference.limb(0) + first, module.limb(0) + first, module.limb(0) + first, lhs.count(), lanes, _limbs, carry.data());
+		for (size_t k = 0; k < _limbs; ++k) {
+			const uint32_t* d = difference.limb(k) + first;
+			const uint32_t* s = module.limb(k) + first;
+			uint32_t* r = result.limb(k) + first;
+			for (size_t j = 0; j < lanes; ++j)
+				r[j] = borrow[j] != 0 ? s[j] : d[j];
+		}
+	}
+
+	return result;
+}
+
+BigIntBatch BatchMontgomeryContext::mul(const BigIntBatch& lhs, const BigIntBatch& rhs) const {
+	check_batch(lhs);
+	lhs.check_shape(rhs);
+	BigIntBatch result(lhs.count(), _limbs);
+	std::vector<uint64_t> t((_limbs + 2) * BigIntBatch::TILE);
+	std::vector<uint64_t> carry(BigIntBatch::TILE);
+	std::vector<uint64_t> m(BigIntBatch::TILE);
+
+	for (size_t first = 0; first < lhs.count(); first += BigIntBatch::TILE)
+		montgomery_tile(lhs.limb(0) + first, rhs.limb(0) + first, result.limb(0) + first, lhs.count(), std::min(BigIntBatch::TILE, lhs.count() - first), _limbs, _module_limbs.data(), _m_inv, t.data(), carry.data(), m.data());
+
+	return result;
+}
+
+BigIntBatch BatchMontgomeryContext::pow(const BigIntBatch& numbers, const BigInt& degree) const {
+	if (degree < 0)
+		throw std::invalid_argument("Raising to a negative power");
+	check_batch(numbers);
+
+	BigIntBatch result = BigIntBatch::broadcast(_r1, numbers.count(), _limbs);
+	for (uint64_t bit = degree.bit_length(); bit-- > 0;) {
+		result = mul(result, result);
+		if (degree.test_bit(bit))
+			result = mul(result, numbers);
+	}
+
+	return result;
+}
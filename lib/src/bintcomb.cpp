@@ -0,0 +1,111 @@
+﻿#include <bintprime.h>
+#include <future>
+
+static BigInt product_range(const BigInt* numbers, size_t count, size_t threads) {
+	if (count == 0)
+		return 1;
+	if (count == 1)
+		return numbers[0];
+	if (count == 2)
+		return numbers[0] * numbers[1];
+
+	size_t half = count / 2;
+	if (threads > 1) {
+		auto left = std::async(std::launch::async, product_range, numbers, half, threads / 2);
+		BigInt right = product_range(numbers + half, count - half, threads - threads / 2);
+		return left.get() * right;
+	}
+
+	return product_range(numbers, half, 1) * product_range(numbers + half, count - half, 1);
+}
+
+static void push_factor(std::vector<BigInt>& factors, uint64_t& word, uint64_t factor) {
+	if (word > UINT64_MAX / factor) {
+		factors.push_back(BigInt::from_scalar(word));
+		word = 1;
+	}
+	word *= factor;
+}
+
+static BigInt prime_swing(uint32_t n, const std::vector<uint32_t>& primes, size_t threads) {
+	std::vector<BigInt> factors;
+	uint64_t word = 1;
+
+	for (uint32_t p : primes) {
+		if (p > n)
+			break;
+
+		uint64_t power = 1;
+		for (uint64_t q = n / p; q > 0; q /= p)
+			if ((q & 1) != 0)
+				power *= p;
+		if (power > 1)
+			push_factor(factors, word, power);
+	}
+
+	if (word > 1)
+		factors.push_back(BigInt::from_scalar(word));
+	return BigInt::product(factors, threads);
+}
+
+static BigInt factorial_range(uint32_t n, const std::vector<uint32_t>& primes, size_t threads) {
+	if (n < 21) {
+		uint64_t result = 1;
+		for (uint32_t i = 2; i <= n; ++i)
+			result *= i;
+		return BigInt::from_scalar(result);
+	}
+
+	return BigInt::karatsuba_square(factorial_range(n / 2, primes, threads)) * prime_swing(n, primes, threads);
+}
+
+BigInt BigInt::product(const std::vector<BigInt>& numbers, size_t threads) {
+	return product_range(numbers.data(), numbers.size(), std::max<size_t>(threads, 1));
+}
+
+BigInt BigInt::factorial(uint32_t n, size_t threads) {
+	std::vector<uint32_t> primes = n < 21 ? std::vector<uint32_t>() : Primality::sieve((uint64_t)n + 1);
+	return factorial_range(n, primes, threads);
+}
+
+BigInt BigInt::binomial(uint32_t n, uint32_t k, size_t threads) {
+	if (k > n)
+		return 0;
+	k = std::min(k, n - k);
+
+	std::vector<BigInt> factors;
+	uint64_t word = 1;
+
+	if ((uint64_t)k * k < BINOMIAL_FALLING_FACTOR * n) {
+		for (uint64_t i = n - k + 1; i <= n; ++i)
+			push_factor(factors, word, i);
+		if (word > 1)
+			factors.push_back(BigInt::from_scalar(word));
+		return BigInt::divexact(BigInt::product(factors, threads), BigInt::factorial(k, threads));
+	}
+
+	for (uint32_t p : Primality::sieve((uint64_t)n + 1)) {
+		uint64_t power = 1;
+		for (uint64_t q = p; q <= n; q *= p)
+			if (n / q - k / q - (n - k) / q != 0)
+				power *= p;
+		if (power > 1)
+			push_factor(factors, word, power);
+	}
+
+	if (word > 1)
+		factors.push_back(BigInt::from_scalar(word));
+	return BigInt::product(factors, threads);
+}
+
+BigInt BigInt::primorial(uint32_t n, size_t threads) {
+	std::vector<BigInt> factors;
+	uint64_t word = 1;
+
+	for (uint32_t p : Primality::sieve((uint64_t)n + 1))
+		push_factor(factors, word, p);
+
+	if (word > 1)
+		factors.push_back(BigInt::from_scalar(word));
+	return BigInt::product(factors, threads);
+}
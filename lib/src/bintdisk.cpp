@@ -0,0 +1,239 @@
+﻿#include <bintdisk.h>
+#include <filesystem>
+#include <future>
+
+DiskBigInt::DiskBigInt(const std::string& path) : _path(path), _size(0), _is_negative(false) {
+	std::error_code error;
+	uintmax_t bytes = std::filesystem::file_size(path, error);
+	if (error || bytes <= HEADER_CHUNKS * sizeof(uint32_t) || bytes % sizeof(uint32_t) != 0)
+		throw std::invalid_argument("File does not contain a number: " + path);
+
+	std::ifstream stream(path, std::ios::binary);
+	uint32_t header = 0;
+	stream.read(reinterpret_cast<char*>(&header), sizeof(header));
+	if (!stream || header > 1)
+		throw std::invalid_argument("File does not contain a number: " + path);
+
+	_size = (size_t)(bytes / sizeof(uint32_t)) - HEADER_CHUNKS;
+	_is_negative = header == 1;
+}
+
+std::vector<uint32_t> DiskBigInt::read_chunks(std::ifstream& stream, size_t first, size_t count) {
+	std::vector<uint32_t> chunks(count);
+	stream.seekg((std::streamoff)((HEADER_CHUNKS + first) * sizeof(uint32_t)));
+	stream.read(reinterpret_cast<char*>(chunks.data()), (std::streamsize)(count * sizeof(uint32_t)));
+	if (!stream)
+		throw std::invalid_argument("Failed to read number chunks");
+
+	return chunks;
+}
+
+void DiskBigInt::write_chunks(std::ofstream& stream, const std::vector<uint32_t>& chunks) {
+	stream.write(reinterpret_cast<const char*>(chunks.data()), (std::streamsize)(chunks.size() * sizeof(uint32_t)));
+	if (!stream)
+		throw std::invalid_argument("Failed to write number chunks");
+}
+
+bool DiskBigInt::same_file(const std::string& lhs, const std::string& rhs) {
+	std::error_code error;
+	return std::filesystem::equivalent(lhs, rhs, error) && !error;
+}
+
+DiskBigInt::ScratchFile::ScratchFile(const std::string& base) : _path(base) {
+	for (size_t attempt = 1; std::filesystem::exists(_path); ++attempt)
+		_path = base + "~" + std::to_string(attempt);
+
+	std::ofstream stream(_path, std::ios::binary | std::ios::trunc);
+	if (!stream)
+		throw std::invalid_argument("Cannot open file: " + _path);
+}
+
+DiskBigInt::ScratchFile::~ScratchFile() {
+	std::error_code error;
+	std::filesystem::remove(_path, error);
+}
+
+const std::string& DiskBigInt::ScratchFile::path() const {
+	return _path;
+}
+
+DiskBigInt DiskBigInt::store(const BigInt& number, const std::string& path) {
+	std::ofstream stream(path, std::ios::binary | std::ios::trunc);
+	if (!stream)
+		throw std::invalid_argument("Cannot open file: " + path);
+
+	bool is_negative = number._is_negative && number != 0;
+	DiskBigInt::write_chunks(stream, std::vector<uint32_t>{ is_negative ? 1u : 0u });
+	DiskBigInt::write_chunks(stream, number._chunks.to_vector());
+	stream.close();
+
+	return DiskBigInt(path);
+}
+
+size_t DiskBigInt::block_size(size_t memory_budget) {
+	return std::max((size_t)BigInt::MUL_KARATSUBA_THRESHOLD, memory_budget / (16 * sizeof(uint32_t)));
+}
+
+DiskBigInt::Slice DiskBigInt::slice() const {
+	return { this, 0, _size };
+}
+
+DiskBigInt DiskBigInt::combine(const std::vector<Term>& terms, size_t size, bool is_negative, const std::string& path, size_t block) {
+	std::vector<std::ifstream> streams;
+	for (auto& term : terms) {
+		streams.emplace_back(term.slice.number->_path, std::ios::binary);
+		if (!streams.back())
+			throw std::invalid_argument("Cannot open file: " + term.slice.number->_path);
+	}
+	std::ofstream stream(path, std::ios::binary | std::ios::trunc);
+	if (!stream)
+		throw std::invalid_argument("Cannot open file: " + path);
+	DiskBigInt::write_chunks(stream, std::vector<uint32_t>(HEADER_CHUNKS, 0));
+
+	auto gather = [&](size_t first) {
+		size_t count = std::min(block, size - first);
+		std::vector<int64_t> sums(count, 0);
+		for (size_t t = 0; t < terms.size(); ++t) {
+			const Term& term = terms[t];
+			size_t low = std::max(first, term.offset);
+			size_t high = std::min(first + count, term.offset + term.slice.count);
+			if (low >= high)
+				continue;
+
+			std::vector<uint32_t> chunks = DiskBigInt::read_chunks(streams[t], term.slice.first + (low - term.offset), high - low);
+			for (size_t j = 0; j < chunks.size(); ++j)
+				sums[low - first + j] += term.negative ? -(int64_t)chunks[j] : (int64_t)chunks[j];
+		}
+		return sums;
+	};
+
+	std::future<std::vector<int64_t>> next = std::async(std::launch::async, gather, 0);
+	std::future<void> writing;
+	int64_t carry = 0;
+	size_t top = 0;
+
+	for (size_t first = 0; first < size; first += block) {
+		std::vector<int64_t> sums = next.get();
+		if (first + block < size)
+			next = std::async(std::launch::async, gather, first + block);
+
+		std::vector<uint32_t> chunks(sums.size());
+		for (size_t j = 0; j < sums.size(); ++j) {
+			int64_t value = sums[j] + carry;
+			chunks[j] = (uint32_t)value;
+			carry = value >> 32;
+			if (chunks[j] != 0)
+				top = first + j + 1;
+		}
+
+		if (writing.valid())
+			writing.get();
+		writing = std::async(std::launch::async, [&stream, chunks = std::move(chunks)]() { DiskBigInt::write_chunks(stream, chunks); });
+	}
+	if (writing.valid())
+		writing.get();
+	if (carry != 0)
+		throw std::invalid_argument("Combined number does not fit into its size");
+
+	stream.seekp(0);
+	DiskBigInt::write_chunks(stream, std::vector<uint32_t>{ is_negative && top != 0 ? 1u : 0u });
+	stream.close();
+
+	size_t trimmed = std::max<size_t>(top, 1);
+	if (trimmed < size)
+		std::filesystem::resize_file(path, (HEADER_CHUNKS + trimmed) * sizeof(uint32_t));
+
+	return DiskBigInt(path);
+}
+
+DiskBigInt DiskBigInt::mul_slices(const Slice& lhs, const Slice& rhs, bool is_negative, const std::string& path, size_t block) {
+	const Slice& a = lhs.count >= rhs.count ? lhs : rhs;
+	const Slice& b = lhs.count >= rhs.count ? rhs : lhs;
+
+	if (a.count <= block) {
+		BigInt product = BigInt::karatsuba_mul(a.number->block(a.first, a.count), b.number->block(b.first, b.count));
+		product._is_negative = is_negative;
+		return DiskBigInt::store(product, path);
+	}
+
+	size_t half = (a.count + 1) / 2;
+	Slice a0 = { a.number, a.first, half };
+	Slice a1 = { a.number, a.first + half, a.count - half };
+
+	if (b.count <= half) {
+		ScratchFile file0(path + ".0");
+		ScratchFile file1(path + ".1");
+		DiskBigInt p0 = DiskBigInt::mul_slices(a0, b, false, file0.path(), block);
+		DiskBigInt p1 = DiskBigInt::mul_slices(a1, b, false, file1.path(), block);
+		return DiskBigInt::combine({ { p0.slice(), 0, false }, { p1.slice(), half, false } }, a.count + b.count, is_negative, path, block);
+	}
+
+	Slice b0 = { b.number, b.first, half };
+	Slice b1 = { b.number, b.first + half, b.count - half };
+
+	ScratchFile file0(path + ".0");
+	ScratchFile file1(path + ".1");
+	ScratchFile file2(path + ".2");
+	DiskBigInt z0 = DiskBigInt::mul_slices(a0, b0, false, file0.path(), block);
+	DiskBigInt z2 = DiskBigInt::mul_slices(a1, b1, false, file2.path(), block);
+	DiskBigInt z1 = [&]() {
+		ScratchFile file_a(path + ".a");
+		ScratchFile file_b(path + ".b");
+		DiskBigInt a_sum = DiskBigInt::combine({ { a0, 0, false }, { a1, 0, false } }, half + 1, false, file_a.path(), block);
+		DiskBigInt b_sum = DiskBigInt::combine({ { b0, 0, false }, { b1, 0, false } }, half + 1, false, file_b.path(), block);
+		return DiskBigInt::mul_slices(a_sum.slice(), b_sum.slice(), false, file1.path(), block);
+	}();
+
+	// z1 spans up to 2 * half + 2 limbs at offset half, which is past a.count + b.count
+	// when a.count is odd and b.count is just over half; its excess limbs cancel.
+	std::vector<Term> terms = {
+		{ z0.slice(), 0, false },
+		{ z1.slice(), half, false },
+		{ z0.slice(), half, true },
+		{ z2.slice(), half, true },
+		{ z2.slice(), 2 * half, false }
+	};
+	size_t size = a.count + b.count;
+	for (auto& term : terms)
+		size = std::max(size, term.offset + term.slice.count);
+	return DiskBigInt::combine(terms, size, is_negative, path, block);
+}
+
+DiskBigInt DiskBigInt::mul(const DiskBigInt& lhs, const DiskBigInt& rhs, const std::string& path, size_t memory_budget) {
+	if (DiskBigInt::same_file(path, lhs._path) || DiskBigInt::same_file(path, rhs._path))
+		throw std::invalid_argument("Result file is an operand: " + path);
+
+	return DiskBigInt::mul_slices(lhs.slice(), rhs.slice(), lhs._is_negative ^ rhs._is_negative, path, DiskBigInt::block_size(memory_budget));
+}
+
+const std::string& DiskBigInt::path() const {
+	return _path;
+}
+
+size_t DiskBigInt::size() const {
+	return _size;
+}
+
+bool DiskBigInt::is_negative() const {
+	return _is_negative;
+}
+
+BigInt DiskBigInt::load() const {
+	BigInt result = block(0, _size);
+	result._is_negative = _is_negative && result != 0;
+	return result;
+}
+
+BigInt DiskBigInt::block(size_t first, size_t count) const {
+	if (first >= _size)
+		return BigInt();
+
+	std::ifstream stream(_path, std::ios::binary);
+	if (!stream)
+		throw std::invalid_argument("Cannot open file: " + _path);
+
+	std::vector<uint32_t> chunks = DiskBigInt::read_chunks(stream, first, std::min(count, _size - first));
+	while (chunks.size() > 1 && chunks.back() == 0)
+		chunks.pop_back();
+	return BigInt(chunks);
+}
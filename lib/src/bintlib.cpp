@@ -80,7 +80,8 @@ int BigInt::abs_cmp(const BigInt& number1, const BigInt& number2) {
 	else if (number1._chunks.size() < number2._chunks.size())
 		return -1;
 	else {
-		for (int i = (int)number1._chunks.size() - 1; i >= 0; i--) {
+		size_t low = std::min(number1._chunks.offset(), number2._chunks.offset());
+		for (size_t i = number1._chunks.size(); i-- > low;) {
 			if (number1._chunks[i] > number2._chunks[i])
 				return 1;
 			else if (number1._chunks[i] < number2._chunks[i])
@@ -92,12 +93,13 @@ int BigInt::abs_cmp(const BigInt& number1, const BigInt& number2) {
 
 BigInt BigInt::sub_chunks(const BigInt& lhs, const BigInt& rhs) {
 	BigInt res;
+	size_t offset = std::min(lhs._chunks.offset(), rhs._chunks.offset());
 	std::vector<uint32_t> result;
-	result.reserve(lhs._chunks.size());
+	result.reserve(lhs._chunks.size() - offset);
 
 	int64_t borrow = 0;
 
-	for (size_t i = 0; i < lhs._chunks.size(); ++i) {
+	for (size_t i = offset; i < lhs._chunks.size(); ++i) {
 		int64_t a = (int64_t)lhs._chunks[i];
 		int64_t b = (i < rhs._chunks.size()) ? (int64_t)rhs._chunks[i] : 0;
 
@@ -114,13 +116,7 @@ BigInt BigInt::sub_chunks(const BigInt& lhs, const BigInt& rhs) {
 		result.push_back((uint32_t)diff);
 	}
 
-	while (result.size() > 1 && result.back() == 0) {
-		result.pop_back();
-	}
-
-	res._chunks = result;
-	res._is_negative = false;
-	return res;
+	return BigInt::assemble(std::move(result), offset, false);
 }
 
 uint32_t BigInt::leading_zeros(uint32_t value) {
@@ -137,6 +133,23 @@ uint32_t BigInt::leading_zeros(uint32_t value) {
 	return count;
 }
 
+uint32_t BigInt::trailing_zeros(uint32_t value) {
+	if (value == 0)
+		return 32;
+
+	uint32_t count = 0;
+	while (((value >> count) & 1) == 0)
+		count++;
+	return count;
+}
+
+uint32_t BigInt::word_inverse(uint32_t number) {
+	uint32_t inverse = number;
+	for (size_t i = 0; i < 4; i++)
+		inverse *= 2 - number * inverse;
+	return inverse;
+}
+
 uint32_t BigInt::estimate_quotient(const BigInt& dividend, const BigInt& divider) {
 	if (dividend._chunks.size() < divider._chunks.size())
 		return 0;
@@ -146,30 +159,388 @@ uint32_t BigInt::estimate_quotient(const BigInt& dividend, const BigInt& divider
 	uint32_t e = divider._chunks.back();
 
 	uint64_t c = (uint64_t)a;
-	if (dividend._chunks.size() > 1)
+	if (dividend._chunks.size() > divider._chunks.size())
 		c = (c << 32) | b;
 
-	c = c / e;
+	c = c / e + 2;
 
-	uint32_t q = (c > UINT32_MAX) ? UINT32_MAX : (uint32_t)c;
+	return (c > UINT32_MAX) ? UINT32_MAX : (uint32_t)c;
+}
 
-	return q + 2;
+uint32_t BigInt::reciprocal_word(uint32_t divider) {
+	return (uint32_t)((((uint64_t)~divider << 32) | UINT32_MAX) / divider);
 }
 
-uint32_t BigInt::bit_length() const {
+uint32_t BigInt::reciprocal_3by2(uint32_t high, uint32_t low) {
+	uint32_t reciprocal = BigInt::reciprocal_word(high);
+	uint32_t p = high * reciprocal + low;
+
+	if (p < low) {
+		reciprocal--;
+		if (p >= high) {
+			reciprocal--;
+			p -= high;
+		}
+		p -= high;
+	}
+
+	uint64_t t = (uint64_t)reciprocal * low;
+	uint32_t t1 = (uint32_t)(t >> 32);
+	p += t1;
+
+	if (p < t1) {
+		reciprocal--;
+		if ((((uint64_t)p << 32) | (uint32_t)t) >= (((uint64_t)high << 32) | low))
+			reciprocal--;
+	}
+
+	return reciprocal;
+}
+
+uint32_t BigInt::div_2by1(uint32_t high, uint32_t low, uint32_t divider, uint32_t reciprocal, uint32_t& remainder) {
+	uint64_t q = (uint64_t)reciprocal * high + (((uint64_t)high << 32) | low);
+	uint32_t q1 = (uint32_t)(q >> 32) + 1;
+	uint32_t q0 = (uint32_t)q;
+	uint32_t r = low - q1 * divider;
+
+	if (r > q0) {
+		q1--;
+		r += divider;
+	}
+	if (r >= divider) {
+		q1++;
+		r -= divider;
+	}
+
+	remainder = r;
+	return q1;
+}
+
+uint32_t BigInt::div_3by2(uint32_t high, uint32_t middle, uint32_t low, uint64_t divider, uint32_t reciprocal, uint64_t& remainder) {
+	uint32_t d1 = (uint32_t)(divider >> 32);
+	uint32_t d0 = (uint32_t)divider;
+
+	uint64_t q = (uint64_t)reciprocal * high + (((uint64_t)high << 32) | middle);
+	uint32_t q1 = (uint32_t)(q >> 32);
+	uint32_t q0 = (uint32_t)q;
+
+	uint32_t r1 = middle - q1 * d1;
+	uint64_t r = (((uint64_t)r1 << 32) | low) - (uint64_t)d0 * q1 - divider;
+	q1++;
+
+	if ((uint32_t)(r >> 32) >= q0) {
+		q1--;
+		r += divider;
+	}
+	if (r >= divider) {
+		q1++;
+		r -= divider;
+	}
+
+	remainder = r;
+	return q1;
+}
+
+uint64_t BigInt::div_chunks_scalar(const BigInt& number, uint64_t divider, std::vector<uint32_t>* quotient_chunks) {
+	const ChunkBuffer& chunks = number._chunks;
+	size_t size = chunks.size();
+
+	if (quotient_chunks != nullptr)
+		quotient_chunks->assign(size, 0);
+
+	if (divider <= UINT32_MAX) {
+		uint32_t shift = BigInt::leading_zeros((uint32_t)divider);
+		uint32_t normalized = (uint32_t)divider << shift;
+		uint32_t reciprocal = BigInt::reciprocal_word(normalized);
+
+		uint32_t remainder = (shift > 0) ? chunks[size - 1] >> (32 - shift) : 0;
+		for (size_t i = size; i-- > 0;) {
+			uint32_t low = chunks[i] << shift;
+			if (shift > 0 && i > 0)
+				low |= chunks[i - 1] >> (32 - shift);
+
+			uint32_t q = BigInt::div_2by1(remainder, low, normalized, reciprocal, remainder);
+			if (quotient_chunks != nullptr)
+				(*quotient_chunks)[i] = q;
+		}
+
+		return remainder >> shift;
+	}
+
+	if (size < 2)
+		return chunks[0];
+
+	uint32_t shift = BigInt::leading_zeros((uint32_t)(divider >> 32));
+	uint64_t normalized = divider << shift;
+	uint32_t reciprocal = BigInt::reciprocal_3by2((uint32_t)(normalized >> 32), (uint32_t)normalized);
+
+	auto shifted_chunk = [&](size_t i) -> uint32_t {
+		uint32_t chunk = (i < size) ? chunks[i] << shift : 0;
+		if (shift > 0 && i > 0)
+			chunk |= chunks[i - 1] >> (32 - shift);
+		return chunk;
+	};
+
+	uint64_t remainder = ((uint64_t)shifted_chunk(size) << 32) | shifted_chunk(size - 1);
+	for (size_t i = size - 1; i-- > 0;) {
+		uint32_t q = BigInt::div_3by2((uint32_t)(remainder >> 32), (uint32_t)remainder, shifted_chunk(i), normalized, reciprocal, remainder);
+		if (quotient_chunks != nullptr)
+			(*quotient_chunks)[i] = q;
+	}
+
+	return remainder >> shift;
+}
+
+BigInt BigInt::from_scalar(uint64_t number, bool is_negative) {
+	BigInt result((uint32_t)number, is_negative);
+	if ((number >> 32) != 0)
+		result._chunks.push_back((uint32_t)(number >> 32));
+	if (number == 0)
+		result._is_negative = false;
+	return result;
+}
+
+int BigInt::abs_cmp_scalar(const BigInt& lhs, uint64_t rhs) {
+	if (lhs._chunks.size() > 2)
+		return 1;
+
+	uint64_t value = lhs._chunks[0];
+	if (lhs._chunks.size() == 2)
+		value |= (uint64_t)lhs._chunks[1] << 32;
+
+	if (value > rhs)
+		return 1;
+	if (value < rhs)
+		return -1;
+	return 0;
+}
+
+int BigInt::cmp_scalar(const BigInt& lhs, uint64_t rhs, bool rhs_negative) {
+	bool lhs_negative = lhs._is_negative && !(lhs._chunks.size() == 1 && lhs._chunks[0] == 0);
+	rhs_negative = rhs_negative && rhs != 0;
+
+	if (lhs_negative != rhs_negative)
+		return lhs_negative ? -1 : 1;
+
+	int check = BigInt::abs_cmp_scalar(lhs, rhs);
+	return lhs_negative ? -check : check;
+}
+
+BigInt BigInt::sum_scalar(const BigInt& lhs, uint64_t rhs, bool rhs_negative) {
+	BigInt res;
+
+	if (lhs._is_negative == rhs_negative) {
+		std::vector<uint32_t> result;
+		result.reserve(std::max(lhs._chunks.size(), (size_t)2) + 1);
+
+		uint64_t carry = rhs;
+		for (size_t i = 0; i < lhs._chunks.size(); ++i) {
+			uint64_t sum = (uint64_t)lhs._chunks[i] + (uint32_t)carry;
+			carry = (carry >> 32) + (sum >> 32);
+			result.push_back((uint32_t)sum);
+		}
+		while (carry > 0) {
+			result.push_back((uint32_t)carry);
+			carry >>= 32;
+		}
+
+		res._chunks = std::move(result);
+		res._is_negative = lhs._is_negative;
+	}
+	else {
+		int check = BigInt::abs_cmp_scalar(lhs, rhs);
+
+		if (check > 0) {
+			std::vector<uint32_t> result;
+			result.reserve(lhs._chunks.size());
+
+			uint64_t borrow = rhs;
+			for (size_t i = 0; i < lhs._chunks.size(); ++i) {
+				uint64_t diff = (uint64_t)lhs._chunks[i] - (uint32_t)borrow;
+				borrow = (borrow >> 32) + (diff >> 63);
+				result.push_back((uint32_t)diff);
+			}
+
+			res._chunks = std::move(result);
+			res._is_negative = lhs._is_negative;
+		}
+		else if (check == 0) {
+			return res;
+		}
+		else {
+			uint64_t value = lhs._chunks[0];
+			if (lhs._chunks.size() == 2)
+				value |= (uint64_t)lhs._chunks[1] << 32;
+			return BigInt::from_scalar(rhs - value, rhs_negative);
+		}
+	}
+
+	while (res._chunks.size() > 1 && res._chunks.back() == 0) {
+		res._chunks.pop_back();
+	}
+	if (res._chunks.size() == 1 && res._chunks[0] == 0)
+		res._is_negative = false;
+
+	return res;
+}
+
+BigInt BigInt::sub_scalar(const BigInt& lhs, uint64_t rhs, bool rhs_negative) {
+	return BigInt::sum_scalar(lhs, rhs, !rhs_negative);
+}
+
+BigInt BigInt::mul_scalar(const BigInt& lhs, uint64_t rhs, bool rhs_negative) {
+	BigInt result;
+
+	uint32_t low = (uint32_t)rhs;
+	uint32_t high = (uint32_t)(rhs >> 32);
+	size_t size = lhs._chunks.size();
+	std::vector<uint32_t> res_chunks(size + 2, 0);
+
+	uint64_t carry = 0;
+	for (size_t i = 0; i < size; ++i) {
+		uint64_t mul = (uint64_t)lhs._chunks[i] * low + carry;
+		res_chunks[i] = (uint32_t)mul;
+		carry = mul >> 32;
+	}
+	res_chunks[size] = (uint32_t)carry;
+
+	if (high != 0) {
+		carry = 0;
+		for (size_t i = 0; i < size; ++i) {
+			uint64_t sum = (uint64_t)lhs._chunks[i] * high + res_chunks[i + 1] + carry;
+			res_chunks[i + 1] = (uint32_t)sum;
+			carry = sum >> 32;
+		}
+		res_chunks[size + 1] = (uint32_t)carry;
+	}
+
+	while (res_chunks.size() > 1 && res_chunks.back() == 0)
+		res_chunks.pop_back();
+
+	result._is_negative = (lhs._is_negative ^ rhs_negative) && !(res_chunks.size() == 1 && res_chunks[0] == 0);
+	result._chunks = std::move(res_chunks);
+
+	return result;
+}
+
+std::pair<BigInt, uint64_t> BigInt::div_scalar(const BigInt& lhs, uint64_t rhs, bool rhs_negative) {
+	if (rhs == 0)
+		throw std::invalid_argument("Division by zero");
+
+	BigInt quotient;
+	std::vector<uint32_t> quotient_chunks;
+	uint64_t remainder = BigInt::div_chunks_scalar(lhs, rhs, &quotient_chunks);
+	quotient._chunks = std::move(quotient_chunks);
+
+	while (quotient._chunks.size() > 1 && quotient._chunks.back() == 0)
+		quotient._chunks.pop_back();
+	quotient._is_negative = (lhs._is_negative ^ rhs_negative) && !(quotient._chunks.size() == 1 && quotient._chunks[0] == 0);
+
+	if (lhs._is_negative && remainder != 0) {
+		remainder = rhs - remainder;
+		quotient = BigInt::sum_scalar(quotient, 1, !rhs_negative);
+	}
+
+	return std::pair<BigInt, uint64_t>(quotient, remainder);
+}
+
+uint64_t BigInt::mod_scalar(const BigInt& lhs, uint64_t rhs) {
+	if (rhs == 0)
+		throw std::invalid_argument("Division by zero");
+
+	uint64_t remainder = BigInt::div_chunks_scalar(lhs, rhs, nullptr);
+	if (lhs._is_negative && remainder != 0)
+		remainder = rhs - remainder;
+
+	return remainder;
+}
+
+uint64_t BigInt::bit_length() const {
 	BigInt zero;
 
 	if (*this == zero)
 		return 0;
 
-	uint32_t total_bits = (uint32_t)(_chunks.size() - 1) * 32;
+	uint64_t total_bits = (uint64_t)(_chunks.size() - 1) * 32;
 	uint32_t top_chunk = _chunks.back();
 	total_bits += 32 - BigInt::leading_zeros(top_chunk);
 	return total_bits;
 }
 
+bool BigInt::test_bit(uint64_t index) const {
+	size_t chunk_index = (size_t)std::min<uint64_t>(index / 32, _chunks.size());
+	uint32_t chunk = chunk_index < _chunks.size() ? _chunks[chunk_index] : 0;
+	if (_is_negative && !(_chunks.size() == 1 && _chunks[0] == 0))
+		chunk = BigInt::complement_chunk(*this, chunk_index, BigInt::low_zero_chunks(*this));
+	return (chunk >> (index % 32)) & 1;
+}
+
+void BigInt::set_bit(uint64_t index, bool value) {
+	if (_chunks.size() == 1 && _chunks[0] == 0)
+		_is_negative = false;
+	if (_is_negative) {
+		BigInt mask = BigInt(1) << index;
+		*this = value ? BigInt::bit_or(*this, mask) : BigInt::bit_and(*this, BigInt::bit_not(mask));
+		return;
+	}
+
+	if (index / 32 >= _chunks.size()) {
+		if (!value)
+			return;
+		_chunks.resize(BigInt::checked_size(index / 32 + 1), 0);
+	}
+	size_t chunk_index = (size_t)(index / 32);
+
+	if (value)
+		_chunks[chunk_index] |= (uint32_t)1 << (index % 32);
+	else
+		_chunks[chunk_index] &= ~((uint32_t)1 << (index % 32));
+
+	while (_chunks.size() > 1 && _chunks.back() == 0)
+		_chunks.pop_back();
+}
+
+uint64_t BigInt::popcount() const {
+	uint64_t count = 0;
+	for (uint32_t chunk : _chunks.stored())
+		count += std::bitset<32>(chunk).count();
+	return count;
+}
+
+uint64_t BigInt::count_trailing_zeros() const {
+	size_t low_zeros = BigInt::low_zero_chunks(*this);
+	if (_chunks[low_zeros] == 0)
+		return 0;
+	return (uint64_t)low_zeros * 32 + BigInt::trailing_zeros(_chunks[low_zeros]);
+}
+
+uint64_t BigInt::extract_bits(uint64_t first, uint32_t count) const {
+	if (count > 64)
+		throw std::invalid_argument("Bit count exceeds 64");
+	if (count == 0)
+		return 0;
+
+	bool is_negative = _is_negative && !(_chunks.size() == 1 && _chunks[0] == 0);
+	size_t low_zeros = is_negative ? BigInt::low_zero_chunks(*this) : 0;
+	size_t chunk_index = (size_t)std::min<uint64_t>(first / 32, _chunks.size());
+	uint32_t bit_shift = first % 32;
+
+	uint32_t chunks[3];
+	for (size_t i = 0; i < 3; i++) {
+		size_t index = chunk_index + i;
+		chunks[i] = is_negative ? BigInt::complement_chunk(*this, index, low_zeros) : (index < _chunks.size() ? _chunks[index] : 0);
+	}
+
+	uint64_t value = ((((uint64_t)chunks[1] << 32) | chunks[0]) >> bit_shift);
+	if (bit_shift > 0)
+		value |= (uint64_t)chunks[2] << (64 - bit_shift);
+	if (count < 64)
+		value &= ((uint64_t)1 << count) - 1;
+	return value;
+}
+
 std::string BigInt::to_string() const {
-	return BigInt::concat_number(_chunks, _is_negative);
+	return BigInt::concat_number(_chunks.to_vector(), _is_negative);
 }
 
 double BigInt::to_double() const {
@@ -228,7 +599,7 @@ BigInt::BigInt(const std::vector<uint32_t>& chunks, bool is_negative) {
 }
 
 std::ostream& operator <<(std::ostream& os, const BigInt& number) {
-	os << BigInt::concat_number(number._chunks, number._is_negative, BigInt::BASE);
+	os << BigInt::concat_number(number._chunks.to_vector(), number._is_negative, BigInt::BASE);
 	return os;
 }
 
@@ -238,11 +609,12 @@ BigInt BigInt::sum(const BigInt& lhs, const BigInt& rhs) {
 	if (lhs._is_negative == rhs._is_negative) {
 		std::vector<uint32_t> result;
 		size_t max_size = std::max(lhs._chunks.size(), rhs._chunks.size());
-		result.reserve(max_size + 1);
+		size_t offset = std::min(lhs._chunks.offset(), rhs._chunks.offset());
+		result.reserve(max_size - offset + 1);
 
 		uint64_t carry = 0;
 
-		for (size_t i = 0; i < max_size; ++i) {
+		for (size_t i = offset; i < max_size; ++i) {
 			uint64_t a = (i < lhs._chunks.size()) ? (uint64_t)lhs._chunks[i] : 0;
 			uint64_t b = (i < rhs._chunks.size()) ? (uint64_t)rhs._chunks[i] : 0;
 
@@ -254,7 +626,8 @@ BigInt BigInt::sum(const BigInt& lhs, const BigInt& rhs) {
 		if (carry > 0) {
 			result.push_back((uint32_t)carry);
 		}
-		res._chunks = result;
+		res._chunks = std::move(result);
+		res._chunks.shift(offset);
 		res._is_negative = lhs._is_negative;
 	}
 	else
@@ -289,50 +662,51 @@ BigInt BigInt::sub(const BigInt& lhs, const BigInt& rhs) {
 }
 
 BigInt BigInt::simple_mul(const BigInt& lhs, const BigInt& rhs) {
-	BigInt result;
+	const std::vector<uint32_t>& lhs_chunks = lhs._chunks.stored();
+	const std::vector<uint32_t>& rhs_chunks = rhs._chunks.stored();
 
-	size_t result_size = lhs._chunks.size() + rhs._chunks.size();
+	size_t result_size = lhs_chunks.size() + rhs_chunks.size();
 	std::vector<uint32_t> res_chunks(result_size, 0);
 
-	for (size_t i = 0; i < lhs._chunks.size(); ++i) {
+	for (size_t i = 0; i < lhs_chunks.size(); ++i) {
+		if (lhs_chunks[i] == 0)
+			continue;
+
 		uint64_t carry = 0;
 
-		for (size_t j = 0; j < rhs._chunks.size(); ++j) {
-			uint64_t mul = (uint64_t)(lhs._chunks[i]) * rhs._chunks[j];
+		for (size_t j = 0; j < rhs_chunks.size(); ++j) {
+			uint64_t mul = (uint64_t)(lhs_chunks[i]) * rhs_chunks[j];
 			uint64_t sum = (uint64_t)(res_chunks[i + j]) + mul + carry;
 
 			res_chunks[i + j] = (uint32_t)(sum % BASE);
 			carry = sum / BASE;
 		}
 
-		res_chunks[i + rhs._chunks.size()] += (uint32_t)carry;
+		res_chunks[i + rhs_chunks.size()] += (uint32_t)carry;
 	}
 
-	while (res_chunks.size() > 1 && res_chunks.back() == 0)
-		res_chunks.pop_back();
-
-	result._chunks = res_chunks;
-	result._is_negative = lhs._is_negative ^ rhs._is_negative;
-
-	return result;
+	return BigInt::assemble(std::move(res_chunks), lhs._chunks.offset() + rhs._chunks.offset(), lhs._is_negative ^ rhs._is_negative);
 }
 
 BigInt BigInt::karatsuba_mul(const BigInt& lhs, const BigInt& rhs) {
-	size_t split_length = (lhs._chunks.size() + lhs._chunks.size()) / 4;
-
-	std::vector<uint32_t> lhs_chunks0(lhs._chunks.begin(), (split_length <= lhs._chunks.size()) ? lhs._chunks.begin() + split_length : lhs._chunks.end());
-	std::vector<uint32_t> lhs_chunks1;
-	if (split_length < lhs._chunks.size())
-		lhs_chunks1 = std::vector<uint32_t>(lhs._chunks.begin() + split_length, lhs._chunks.end());
-	std::vector<uint32_t> rhs_chunks0(rhs._chunks.begin(), (split_length <= rhs._chunks.size()) ? rhs._chunks.begin() + split_length : rhs._chunks.end());
-	std::vector<uint32_t> rhs_chunks1;
-	if (split_length < rhs._chunks.size())
-		rhs_chunks1 = std::vector<uint32_t>(rhs._chunks.begin() + split_length, rhs._chunks.end());
-
-	BigInt lhs0(lhs_chunks0);
-	BigInt lhs1(lhs_chunks1);
-	BigInt rhs0(rhs_chunks0);
-	BigInt rhs1(rhs_chunks1);
+	size_t lhs_zeros = BigInt::low_zero_chunks(lhs);
+	size_t rhs_zeros = BigInt::low_zero_chunks(rhs);
+	size_t lhs_size = lhs._chunks.size() - lhs_zeros;
+	size_t rhs_size = rhs._chunks.size() - rhs_zeros;
+
+	size_t min_size = std::min(lhs_size, rhs_size);
+	size_t max_size = std::max(lhs_size, rhs_size);
+	if (min_size <= MUL_KARATSUBA_THRESHOLD)
+		return BigInt::simple_mul(lhs, rhs);
+	if (4 * max_size >= 5 * min_size)
+		return BigInt::unbalanced_mul(lhs, rhs);
+
+	size_t split_length = max_size / 2;
+
+	BigInt lhs0 = BigInt::chunk_slice(lhs, lhs_zeros, split_length);
+	BigInt lhs1 = BigInt::chunk_slice(lhs, lhs_zeros + split_length, lhs_size);
+	BigInt rhs0 = BigInt::chunk_slice(rhs, rhs_zeros, split_length);
+	BigInt rhs1 = BigInt::chunk_slice(rhs, rhs_zeros + split_length, rhs_size);
 	
 	BigInt r2 = (lhs1._chunks.size() == 1 || rhs1._chunks.size() == 1) ? BigInt::simple_mul(lhs1, rhs1) : BigInt::karatsuba_mul(lhs1, rhs1);
 	BigInt r0 = (lhs0._chunks.size() == 1 || rhs0._chunks.size() == 1) ? BigInt::simple_mul(lhs0, rhs0) : BigInt::karatsuba_mul(lhs0, rhs0);
@@ -341,91 +715,386 @@ BigInt BigInt::karatsuba_mul(const BigInt& lhs, const BigInt& rhs) {
 	BigInt tmp = (lhs01._chunks.size() == 1 || rhs01._chunks.size() == 1) ? BigInt::simple_mul(lhs01, rhs01) : BigInt::karatsuba_mul(lhs01, rhs01);
 	BigInt r1 = tmp - r2 - r0;
 
-	std::vector<uint32_t> res_chunks2;
-	for (size_t i = 0; i < 2 * split_length; i++)
-		res_chunks2.push_back(0);
-	for (size_t i = 0; i < r2._chunks.size(); i++)
-		res_chunks2.push_back(r2._chunks[i]);
+	std::vector<uint32_t> res_chunks(lhs_size + rhs_size + 1, 0);
+	BigInt::add_chunks(res_chunks, r0, 0);
+	BigInt::add_chunks(res_chunks, r1, split_length);
+	BigInt::add_chunks(res_chunks, r2, 2 * split_length);
 
-	std::vector<uint32_t> res_chunks1;
-	for (size_t i = 0; i < split_length; i++)
-		res_chunks1.push_back(0);
-	for (size_t i = 0; i < r1._chunks.size(); i++)
-		res_chunks1.push_back(r1._chunks[i]);
+	return BigInt::assemble(std::move(res_chunks), lhs_zeros + rhs_zeros, lhs._is_negative ^ rhs._is_negative);
+}
 
-	std::vector<uint32_t> res_chunks0 = r0._chunks;
+BigInt BigInt::chunk_slice(const BigInt& number, size_t first, size_t count) {
+	if (first >= number._chunks.size())
+		return BigInt();
 
-	BigInt res2(res_chunks2);
-	BigInt res1(res_chunks1);
-	BigInt res0(res_chunks0);
-	BigInt result = res2 + res1 + res0;
-	result._is_negative = lhs._is_negative ^ rhs._is_negative;
+	size_t last = first + std::min(count, number._chunks.size() - first);
+	size_t offset = number._chunks.offset();
+	if (last <= offset)
+		return BigInt();
 
-	while (result._chunks.size() > 1 && result._chunks.back() == 0) {
-		result._chunks.pop_back();
+	size_t low = std::max(first, offset);
+	auto begin = number._chunks.stored().begin();
+	return BigInt::assemble(std::vector<uint32_t>(begin + (low - offset), begin + (last - offset)), low - first, false);
+}
+
+void BigInt::add_chunks(std::vector<uint32_t>& chunks, const BigInt& number, size_t offset) {
+	const std::vector<uint32_t>& number_chunks = number._chunks.stored();
+	offset += number._chunks.offset();
+	if (chunks.size() < offset + number_chunks.size())
+		chunks.resize(offset + number_chunks.size(), 0);
+
+	uint64_t carry = 0;
+	size_t i = 0;
+	for (; i < number_chunks.size(); ++i) {
+		uint64_t sum = (uint64_t)chunks[offset + i] + number_chunks[i] + carry;
+		chunks[offset + i] = (uint32_t)sum;
+		carry = sum >> 32;
+	}
+	for (i += offset; carry != 0; ++i) {
+		if (i == chunks.size())
+			chunks.push_back(0);
+		uint64_t sum = (uint64_t)chunks[i] + carry;
+		chunks[i] = (uint32_t)sum;
+		carry = sum >> 32;
+	}
+}
+
+void BigInt::sub_chunks_at(std::vector<uint32_t>& chunks, const BigInt& number, size_t offset) {
+	const std::vector<uint32_t>& number_chunks = number._chunks.stored();
+	offset += number._chunks.offset();
+	uint64_t borrow = 0;
+	size_t i = 0;
+	for (; i < number_chunks.size() && offset + i < chunks.size(); ++i) {
+		uint64_t difference = (uint64_t)chunks[offset + i] - number_chunks[i] - borrow;
+		chunks[offset + i] = (uint32_t)difference;
+		borrow = difference >> 63;
 	}
+	for (i += offset; borrow != 0 && i < chunks.size(); ++i) {
+		uint64_t difference = (uint64_t)chunks[i] - borrow;
+		chunks[i] = (uint32_t)difference;
+		borrow = difference >> 63;
+	}
+}
+
+size_t BigInt::low_zero_chunks(const BigInt& number) {
+	const std::vector<uint32_t>& chunks = number._chunks.stored();
+	size_t count = 0;
+	while (count + 1 < chunks.size() && chunks[count] == 0)
+		count++;
+	return number._chunks.offset() + count;
+}
 
+size_t BigInt::checked_size(uint64_t chunks) {
+	if (chunks > MAX_CHUNKS)
+		throw std::invalid_argument("Number size exceeds the maximum");
+	return (size_t)chunks;
+}
+
+BigInt BigInt::assemble(std::vector<uint32_t>&& chunks, size_t offset, bool is_negative) {
+	while (chunks.size() > 1 && chunks.back() == 0)
+		chunks.pop_back();
+	if (chunks.empty())
+		chunks.push_back(0);
+
+	BigInt result;
+	bool is_zero = chunks.size() == 1 && chunks[0] == 0;
+	result._chunks = std::move(chunks);
+	if (!is_zero)
+		result._chunks.shift(offset);
+	result._is_negative = is_negative && !is_zero;
 	return result;
 }
 
+BigInt BigInt::toom32_mul(const BigInt& lhs, const BigInt& rhs) {
+	size_t lhs_zeros = BigInt::low_zero_chunks(lhs);
+	size_t rhs_zeros = BigInt::low_zero_chunks(rhs);
+	bool ordered = lhs._chunks.size() - lhs_zeros >= rhs._chunks.size() - rhs_zeros;
+	const BigInt& a = ordered ? lhs : rhs;
+	const BigInt& b = ordered ? rhs : lhs;
+	size_t a_zeros = ordered ? lhs_zeros : rhs_zeros;
+	size_t b_zeros = ordered ? rhs_zeros : lhs_zeros;
+	size_t n = a._chunks.size() - a_zeros;
+	size_t m = b._chunks.size() - b_zeros;
+	size_t split_length = std::max((n + 2) / 3, (m + 1) / 2);
+
+	BigInt a0 = BigInt::chunk_slice(a, a_zeros, split_length);
+	BigInt a1 = BigInt::chunk_slice(a, a_zeros + split_length, split_length);
+	BigInt a2 = BigInt::chunk_slice(a, a_zeros + 2 * split_length, n);
+	BigInt b0 = BigInt::chunk_slice(b, b_zeros, split_length);
+	BigInt b1 = BigInt::chunk_slice(b, b_zeros + split_length, m);
+
+	BigInt a02 = a0 + a2;
+	BigInt v0 = BigInt::karatsuba_mul(a0, b0);
+	BigInt v1 = BigInt::karatsuba_mul(a02 + a1, b0 + b1);
+	BigInt vm1 = BigInt::karatsuba_mul(a02 - a1, b0 - b1);
+	BigInt vinf = BigInt::karatsuba_mul(a2, b1);
+
+	BigInt c1 = BigInt::divexact(v1 - vm1, 2) - vinf;
+	BigInt c2 = BigInt::divexact(v1 + vm1, 2) - v0;
+
+	std::vector<uint32_t> res_chunks(n + m + 1, 0);
+	BigInt::add_chunks(res_chunks, v0, 0);
+	BigInt::add_chunks(res_chunks, c1, split_length);
+	BigInt::add_chunks(res_chunks, c2, 2 * split_length);
+	BigInt::add_chunks(res_chunks, vinf, 3 * split_length);
+
+	return BigInt::assemble(std::move(res_chunks), a_zeros + b_zeros, lhs._is_negative ^ rhs._is_negative);
+}
+
+BigInt BigInt::toom42_mul(const BigInt& lhs, const BigInt& rhs) {
+	size_t lhs_zeros = BigInt::low_zero_chunks(lhs);
+	size_t rhs_zeros = BigInt::low_zero_chunks(rhs);
+	bool ordered = lhs._chunks.size() - lhs_zeros >= rhs._chunks.size() - rhs_zeros;
+	const BigInt& a = ordered ? lhs : rhs;
+	const BigInt& b = ordered ? rhs : lhs;
+	size_t a_zeros = ordered ? lhs_zeros : rhs_zeros;
+	size_t b_zeros = ordered ? rhs_zeros : lhs_zeros;
+	size_t n = a._chunks.size() - a_zeros;
+	size_t m = b._chunks.size() - b_zeros;
+	size_t split_length = std::max((n + 3) / 4, (m + 1) / 2);
+
+	BigInt a0 = BigInt::chunk_slice(a, a_zeros, split_length);
+	BigInt a1 = BigInt::chunk_slice(a, a_zeros + split_length, split_length);
+	BigInt a2 = BigInt::chunk_slice(a, a_zeros + 2 * split_length, split_length);
+	BigInt a3 = BigInt::chunk_slice(a, a_zeros + 3 * split_length, n);
+	BigInt b0 = BigInt::chunk_slice(b, b_zeros, split_length);
+	BigInt b1 = BigInt::chunk_slice(b, b_zeros + split_length, m);
+
+	BigInt a02 = a0 + a2;
+	BigInt a13 = a1 + a3;
+	BigInt v0 = BigInt::karatsuba_mul(a0, b0);
+	BigInt v1 = BigInt::karatsuba_mul(a02 + a13, b0 + b1);
+	BigInt vm1 = BigInt::karatsuba_mul(a02 - a13, b0 - b1);
+	BigInt v2 = BigInt::karatsuba_mul(a0 + (a1 << 1) + (a2 << 2) + (a3 << 3), b0 + (b1 << 1));
+	BigInt vinf = BigInt::karatsuba_mul(a3, b1);
+
+	BigInt c2 = BigInt::divexact(v1 + vm1, 2) - v0 - vinf;
+	BigInt c13 = BigInt::divexact(v1 - vm1, 2);
+	BigInt c3 = BigInt::divexact(BigInt::divexact(v2 - v0 - (c2 << 2) - (vinf << 4), 2) - c13, 3);
+	BigInt c1 = c13 - c3;
+
+	std::vector<uint32_t> res_chunks(n + m + 1, 0);
+	BigInt::add_chunks(res_chunks, v0, 0);
+	BigInt::add_chunks(res_chunks, c1, split_length);
+	BigInt::add_chunks(res_chunks, c2, 2 * split_length);
+	BigInt::add_chunks(res_chunks, c3, 3 * split_length);
+	BigInt::add_chunks(res_chunks, vinf, 4 * split_length);
+
+	return BigInt::assemble(std::move(res_chunks), a_zeros + b_zeros, lhs._is_negative ^ rhs._is_negative);
+}
+
+BigInt BigInt::unbalanced_mul(const BigInt& lhs, const BigInt& rhs) {
+	size_t lhs_zeros = BigInt::low_zero_chunks(lhs);
+	size_t rhs_zeros = BigInt::low_zero_chunks(rhs);
+	bool ordered = lhs._chunks.size() - lhs_zeros >= rhs._chunks.size() - rhs_zeros;
+	const BigInt& a = ordered ? lhs : rhs;
+	const BigInt& b = ordered ? rhs : lhs;
+	size_t a_zeros = ordered ? lhs_zeros : rhs_zeros;
+	size_t b_zeros = ordered ? rhs_zeros : lhs_zeros;
+	size_t n = a._chunks.size() - a_zeros;
+	size_t m = b._chunks.size() - b_zeros;
+
+	if (m <= MUL_KARATSUBA_THRESHOLD)
+		return BigInt::simple_mul(a, b);
+	if (4 * n < 5 * m)
+		return BigInt::karatsuba_mul(a, b);
+	if (2 * n < 3 * m)
+		return BigInt::toom32_mul(a, b);
+	if (2 * n < 5 * m)
+		return BigInt::toom42_mul(a, b);
+
+	BigInt b_low = BigInt::chunk_slice(b, b_zeros, m);
+	std::vector<uint32_t> res_chunks(n + m, 0);
+	for (size_t offset = 0; offset < n; offset += m)
+		BigInt::add_chunks(res_chunks, BigInt::karatsuba_mul(BigInt::chunk_slice(a, a_zeros + offset, m), b_low), offset);
+
+	return BigInt::assemble(std::move(res_chunks), a_zeros + b_zeros, lhs._is_negative ^ rhs._is_negative);
+}
+
+BigInt BigInt::sqr_basecase(const BigInt& number) {
+	const std::vector<uint32_t>& chunks = number._chunks.stored();
+	size_t size = chunks.size();
+	std::vector<uint32_t> res_chunks(2 * size, 0);
+
+	for (size_t i = 0; i < size; ++i) {
+		uint64_t carry = 0;
+
+		for (size_t j = i + 1; j < size; ++j) {
+			uint64_t mul = (uint64_t)(chunks[i]) * chunks[j];
+			uint64_t sum = (uint64_t)(res_chunks[i + j]) + mul + carry;
+
+			res_chunks[i + j] = (uint32_t)sum;
+			carry = sum >> 32;
+		}
+
+		res_chunks[i + size] = (uint32_t)carry;
+	}
+
+	uint32_t shift_carry = 0;
+	for (size_t i = 0; i < res_chunks.size(); ++i) {
+		uint32_t new_carry = res_chunks[i] >> 31;
+		res_chunks[i] = (res_chunks[i] << 1) | shift_carry;
+		shift_carry = new_carry;
+	}
+
+	uint64_t carry = 0;
+	for (size_t i = 0; i < size; ++i) {
+		uint64_t square = (uint64_t)(chunks[i]) * chunks[i];
+
+		uint64_t sum = (uint64_t)(res_chunks[2 * i]) + (uint32_t)square + carry;
+		res_chunks[2 * i] = (uint32_t)sum;
+		carry = sum >> 32;
+
+		sum = (uint64_t)(res_chunks[2 * i + 1]) + (square >> 32) + carry;
+		res_chunks[2 * i + 1] = (uint32_t)sum;
+		carry = sum >> 32;
+	}
+
+	return BigInt::assemble(std::move(res_chunks), 2 * number._chunks.offset(), false);
+}
+
 BigInt BigInt::karatsuba_square(const BigInt& number) {
-	size_t split_length = number._chunks.size() / 2;
+	size_t low_zeros = BigInt::low_zero_chunks(number);
+	size_t size = number._chunks.size() - low_zeros;
+	if (size <= SQR_KARATSUBA_THRESHOLD)
+		return BigInt::sqr_basecase(number);
 
-	std::vector<uint32_t> number_chunks0(number._chunks.begin(), (split_length <= number._chunks.size()) ? number._chunks.begin() + split_length : number._chunks.end());
-	std::vector<uint32_t> number_chunks1;
-	if (split_length < number._chunks.size())
-		number_chunks1 = std::vector<uint32_t>(number._chunks.begin() + split_length, number._chunks.end());
+	size_t split_length = size / 2;
 
-	BigInt number0(number_chunks0);
-	BigInt number1(number_chunks1);
+	BigInt number0 = BigInt::chunk_slice(number, low_zeros, split_length);
+	BigInt number1 = BigInt::chunk_slice(number, low_zeros + split_length, size);
 
-	BigInt r2 = (number1._chunks.size() == 1) ? BigInt::simple_mul(number1, number1) : BigInt::karatsuba_square(number1);
-	BigInt r0 = (number0._chunks.size() == 1) ? BigInt::simple_mul(number0, number0) : BigInt::karatsuba_square(number0);
+	BigInt r2 = BigInt::karatsuba_square(number1);
+	BigInt r0 = BigInt::karatsuba_square(number0);
 	BigInt number01 = number0 + number1;
-	BigInt tmp = (number01._chunks.size() == 1) ? BigInt::simple_mul(number01, number01) : BigInt::karatsuba_square(number01);
+	BigInt tmp = BigInt::karatsuba_square(number01);
 	BigInt r1 = tmp - r2 - r0;
 
-	std::vector<uint32_t> res_chunks2;
-	for (size_t i = 0; i < 2 * split_length; i++)
-		res_chunks2.push_back(0);
-	for (size_t i = 0; i < r2._chunks.size(); i++)
-		res_chunks2.push_back(r2._chunks[i]);
+	std::vector<uint32_t> res_chunks(2 * size + 1, 0);
+	BigInt::add_chunks(res_chunks, r0, 0);
+	BigInt::add_chunks(res_chunks, r1, split_length);
+	BigInt::add_chunks(res_chunks, r2, 2 * split_length);
 
-	std::vector<uint32_t> res_chunks1;
-	for (size_t i = 0; i < split_length; i++)
-		res_chunks1.push_back(0);
-	for (size_t i = 0; i < r1._chunks.size(); i++)
-		res_chunks1.push_back(r1._chunks[i]);
+	return BigInt::assemble(std::move(res_chunks), 2 * low_zeros, false);
+}
 
-	std::vector<uint32_t> res_chunks0 = r0._chunks;
+BigInt BigInt::reciprocal(const BigInt& divider) {
+	size_t size = divider._chunks.size();
+	std::vector<uint32_t> power_chunks(2 * size + 1, 0);
+	power_chunks.back() = 1;
+	BigInt power(power_chunks);
+
+	if (size < DIV_NEWTON_THRESHOLD)
+		return BigInt::div(power, divider).first;
+
+	size_t high_size = size / 2 + 2;
+	size_t low_size = size - high_size;
+	BigInt high(std::vector<uint32_t>(divider._chunks.begin() + low_size, divider._chunks.end()));
+
+	BigInt inverse = BigInt::reciprocal(high);
+	inverse._chunks.insert(inverse._chunks.begin(), low_size, 0);
+
+	BigInt error = power - divider * inverse;
+	size_t skip = high_size - 3;
+	BigInt correction = BigInt::abs(error) * BigInt(std::vector<uint32_t>(inverse._chunks.begin() + skip, inverse._chunks.end()));
+	if (correction._chunks.size() > 2 * size - skip) {
+		correction._chunks.erase(correction._chunks.begin(), correction._chunks.begin() + (2 * size - skip));
+		correction._is_negative = error._is_negative;
+		inverse += correction;
+		error -= divider * correction;
+	}
 
-	BigInt res2(res_chunks2);
-	BigInt res1(res_chunks1);
-	BigInt res0(res_chunks0);
-	BigInt result = res2 + res1 + res0;
-	result._is_negative = false;
+	while (error < 0) {
+		error += divider;
+		inverse -= 1;
+	}
+	while (error >= divider) {
+		error -= divider;
+		inverse += 1;
+	}
 
-	while (result._chunks.size() > 1 && result._chunks.back() == 0) {
-		result._chunks.pop_back();
+	return inverse;
+}
+
+std::pair<BigInt, BigInt> BigInt::div_newton(const BigInt& dividend, const BigInt& divider) {
+	size_t size = divider._chunks.size();
+	BigInt inverse = BigInt::reciprocal(divider);
+
+	size_t blocks = (dividend._chunks.size() + size - 1) / size;
+	std::vector<uint32_t> quotient_chunks(blocks * size, 0);
+	BigInt remainder;
+
+	for (size_t block = blocks; block-- > 0;) {
+		auto first = dividend._chunks.begin() + block * size;
+		std::vector<uint32_t> chunks(first, first + std::min(size, dividend._chunks.size() - block * size));
+		chunks.resize(size, 0);
+		chunks.insert(chunks.end(), remainder._chunks.begin(), remainder._chunks.end());
+		while (chunks.size() > 1 && chunks.back() == 0)
+			chunks.pop_back();
+
+		BigInt current(chunks);
+		BigInt quotient;
+		if (chunks.size() > size)
+			quotient = BigInt(std::vector<uint32_t>(chunks.begin() + (size - 1), chunks.end())) * inverse;
+		if (quotient._chunks.size() > size + 1)
+			quotient._chunks.erase(quotient._chunks.begin(), quotient._chunks.begin() + (size + 1));
+		else
+			quotient = BigInt();
+
+		remainder = current - divider * quotient;
+		while (remainder < 0) {
+			remainder += divider;
+			quotient -= 1;
+		}
+		while (remainder >= divider) {
+			remainder -= divider;
+			quotient += 1;
+		}
+
+		std::copy(quotient._chunks.begin(), quotient._chunks.end(), quotient_chunks.begin() + block * size);
 	}
 
-	return result;
+	while (quotient_chunks.size() > 1 && quotient_chunks.back() == 0)
+		quotient_chunks.pop_back();
+
+	return std::pair<BigInt, BigInt>(BigInt(quotient_chunks), remainder);
 }
 
 std::pair<BigInt, BigInt> BigInt::div(const BigInt& lhs, const BigInt& rhs) {
-	BigInt zero;
-	if (rhs == zero)
+	if (rhs == 0)
 		throw std::invalid_argument("Division by zero");
 
+	if (rhs._chunks.size() <= 2) {
+		uint64_t divider = rhs._chunks[0];
+		if (rhs._chunks.size() == 2)
+			divider |= (uint64_t)rhs._chunks[1] << 32;
+
+		auto [quotient, remainder] = BigInt::div_scalar(lhs, divider, rhs._is_negative);
+		return std::pair<BigInt, BigInt>(quotient, BigInt::from_scalar(remainder));
+	}
+
 	uint32_t shift = leading_zeros(rhs._chunks.back());
 	BigInt dividend = BigInt::abs(lhs << shift);
 	BigInt divider = BigInt::abs(rhs << shift);
 
+	if (divider._chunks.size() >= DIV_NEWTON_THRESHOLD) {
+		auto [quotient, remainder] = BigInt::div_newton(dividend, divider);
+		remainder = remainder >> shift;
+		quotient._is_negative = lhs._is_negative ^ rhs._is_negative;
+
+		if (lhs._is_negative && remainder != 0) {
+			remainder = -remainder + BigInt::abs(rhs);
+			quotient = BigInt::sum_scalar(quotient, 1, !rhs._is_negative);
+		}
+
+		return std::pair<BigInt, BigInt>(quotient, remainder);
+	}
+
 	std::list<uint32_t> quotient_chunks;
 	BigInt remainder;
 	remainder._chunks.clear();
 
-	for (int i = (int)dividend._chunks.size() - 1; i >= 0; i--) {
+	for (size_t i = dividend._chunks.size(); i-- > 0;) {
 		remainder._chunks.insert(remainder._chunks.begin(), dividend._chunks[i]);
 
 		while (!remainder._chunks.empty() && remainder._chunks.back() == 0) {
@@ -438,14 +1107,16 @@ std::pair<BigInt, BigInt> BigInt::div(const BigInt& lhs, const BigInt& rhs) {
 
 		uint32_t q = BigInt::estimate_quotient(remainder, divider);
 
-		while (divider * BigInt(q) > remainder) {
+		while (divider * q > remainder) {
 			q--;
 		}
 
 		quotient_chunks.push_front(q);
-		remainder = remainder - BigInt(q) * divider;
+		remainder = remainder - divider * q;
 	}
 
+	if (remainder._chunks.empty())
+		remainder._chunks.push_back(0);
 	remainder = remainder >> shift;
 	while (quotient_chunks.size() > 1 && quotient_chunks.back() == 0) {
 		quotient_chunks.pop_back();
@@ -453,9 +1124,9 @@ std::pair<BigInt, BigInt> BigInt::div(const BigInt& lhs, const BigInt& rhs) {
 
 	BigInt quotient(std::vector<uint32_t>(quotient_chunks.begin(), quotient_chunks.end()), lhs._is_negative ^ rhs._is_negative);
 
-	if (lhs._is_negative && remainder != zero) {
+	if (lhs._is_negative && remainder != 0) {
 		remainder = -remainder + BigInt::abs(rhs);
-		quotient -= 1;
+		quotient = BigInt::sum_scalar(quotient, 1, !rhs._is_negative);
 	}
 
 	while (remainder._chunks.size() > 1 && remainder._chunks.back() == 0) {
@@ -466,18 +1137,32 @@ std::pair<BigInt, BigInt> BigInt::div(const BigInt& lhs, const BigInt& rhs) {
 }
  
 BigInt BigInt::mod(const BigInt& lhs, const BigInt& rhs) {
-	BigInt zero;
-	if (rhs == zero)
+	if (rhs == 0)
 		throw std::invalid_argument("Division by zero");
 
+	if (rhs._chunks.size() <= 2) {
+		uint64_t divider = rhs._chunks[0];
+		if (rhs._chunks.size() == 2)
+			divider |= (uint64_t)rhs._chunks[1] << 32;
+
+		return BigInt::from_scalar(BigInt::mod_scalar(lhs, divider));
+	}
+
 	uint32_t shift = leading_zeros(rhs._chunks.back());
 	BigInt dividend = BigInt::abs(lhs << shift);
 	BigInt divider = BigInt::abs(rhs << shift);
 
+	if (divider._chunks.size() >= DIV_NEWTON_THRESHOLD) {
+		BigInt remainder = BigInt::div_newton(dividend, divider).second >> shift;
+		if (lhs._is_negative && remainder != 0)
+			remainder = -remainder + BigInt::abs(rhs);
+		return remainder;
+	}
+
 	BigInt remainder;
 	remainder._chunks.clear();
 
-	for (int i = (int)dividend._chunks.size() - 1; i >= 0; i--) {
+	for (size_t i = dividend._chunks.size(); i-- > 0;) {
 		remainder._chunks.insert(remainder._chunks.begin(), dividend._chunks[i]);
 
 		while (!remainder._chunks.empty() && remainder._chunks.back() == 0) {
@@ -489,13 +1174,15 @@ BigInt BigInt::mod(const BigInt& lhs, const BigInt& rhs) {
 
 		uint32_t q = BigInt::estimate_quotient(remainder, divider);
 
-		while (divider * BigInt(q) > remainder) {
+		while (divider * q > remainder) {
 			q--;
 		}
 
-		remainder = remainder - BigInt(q) * divider;
+		remainder = remainder - divider * q;
 	}
 
+	if (remainder._chunks.empty())
+		remainder._chunks.push_back(0);
 	remainder = remainder >> shift;
 
 
@@ -509,6 +1196,104 @@ BigInt BigInt::mod(const BigInt& lhs, const BigInt& rhs) {
 	return remainder;
 }
 
+BigInt BigInt::divexact(const BigInt& dividend, uint32_t divider) {
+	if (divider == 0)
+		throw std::invalid_argument("Division by zero");
+
+	uint32_t zeros = BigInt::trailing_zeros(divider);
+	divider >>= zeros;
+	uint32_t inverse = BigInt::word_inverse(divider);
+	size_t size = dividend._chunks.size();
+	std::vector<uint32_t> chunks(size);
+	uint32_t borrow = 0;
+
+	for (size_t i = 0; i < size; i++) {
+		uint32_t chunk = dividend._chunks[i] >> zeros;
+		if (zeros != 0 && i + 1 < size)
+			chunk |= dividend._chunks[i + 1] << (32 - zeros);
+
+		uint32_t next_borrow = chunk < borrow ? 1 : 0;
+		chunks[i] = (chunk - borrow) * inverse;
+		borrow = (uint32_t)(((uint64_t)chunks[i] * divider) >> 32) + next_borrow;
+	}
+
+	while (chunks.size() > 1 && chunks.back() == 0)
+		chunks.pop_back();
+
+	return BigInt(chunks, dividend._is_negative && !(chunks.size() == 1 && chunks[0] == 0));
+}
+
+BigInt BigInt::divexact(const BigInt& dividend, const BigInt& divider) {
+	if (divider == 0)
+		throw std::invalid_argument("Division by zero");
+
+	bool is_negative = dividend._is_negative ^ divider._is_negative;
+	if (divider._chunks.size() == 1) {
+		BigInt quotient = BigInt::divexact(BigInt::abs(dividend), divider._chunks[0]);
+		quotient._is_negative = is_negative && quotient != 0;
+		return quotient;
+	}
+
+	uint64_t zeros = divider.count_trailing_zeros();
+	BigInt a = BigInt::right_shift(BigInt::abs(dividend), zeros);
+	BigInt b = BigInt::right_shift(BigInt::abs(divider), zeros);
+	if (a._chunks.size() < b._chunks.size())
+		return BigInt();
+
+	size_t size = a._chunks.size() - b._chunks.size() + 1;
+	size_t block = std::min(size, b._chunks.size());
+	std::vector<uint32_t> rest(a._chunks.begin(), a._chunks.begin() + size);
+	std::vector<uint32_t> chunks(size);
+
+	if (block >= DIV_NEWTON_THRESHOLD) {
+		uint64_t bits = (uint64_t)32 * block;
+		BigInt low_divider = BigInt::chunk_slice(b, 0, block);
+		BigInt inverse = BigInt(BigInt::word_inverse(b._chunks[0]));
+		for (uint64_t precision = 32; precision < bits;) {
+			precision = std::min(2 * precision, bits);
+			inverse = BigInt::low_bits(inverse * (BigInt(2) - BigInt::low_bits(low_divider, precision) * inverse), precision);
+		}
+
+		for (size_t offset = 0; offset < size; offset += block) {
+			size_t count = std::min(block, size - offset);
+			BigInt low = BigInt::chunk_slice(BigInt(std::vector<uint32_t>(rest.begin() + offset, rest.begin() + offset + count)), 0, count);
+			BigInt q = BigInt::low_bits(low * inverse, (uint64_t)32 * count);
+			std::copy(q._chunks.begin(), q._chunks.end(), chunks.begin() + offset);
+			if (offset + count < size)
+				BigInt::sub_chunks_at(rest, q * BigInt::chunk_slice(b, 0, size - offset), offset);
+		}
+	}
+	else {
+		uint32_t inverse = BigInt::word_inverse(b._chunks[0]);
+
+		for (size_t i = 0; i < size; i++) {
+			uint32_t q = rest[i] * inverse;
+			chunks[i] = q;
+
+			size_t count = std::min(b._chunks.size(), size - i);
+			uint64_t borrow = 0;
+			for (size_t j = 0; j < count; j++) {
+				uint64_t product = (uint64_t)q * b._chunks[j] + borrow;
+				uint32_t low = (uint32_t)product;
+				borrow = (product >> 32) + (rest[i + j] < low ? 1 : 0);
+				rest[i + j] -= low;
+			}
+			for (size_t j = i + count; borrow != 0 && j < size; j++) {
+				uint64_t value = (uint64_t)rest[j] - borrow;
+				rest[j] = (uint32_t)value;
+				borrow = value >> 63;
+			}
+		}
+	}
+
+	while (chunks.size() > 1 && chunks.back() == 0)
+		chunks.pop_back();
+
+	BigInt quotient(chunks);
+	quotient._is_negative = is_negative && quotient != 0;
+	return quotient;
+}
+
 std::tuple<BigInt, BigInt, BigInt> BigInt::extended_gcd(const BigInt& lhs, const BigInt& rhs) {
 	BigInt zero;
 	BigInt one = 1;
@@ -547,6 +1332,13 @@ BigInt BigInt::gcd(const BigInt& lhs, const BigInt& rhs) {
 	return BigInt::gcd(rhs, lhs % rhs);
 }
 
+BigInt BigInt::lcm(const BigInt& lhs, const BigInt& rhs) {
+	if (lhs == 0 || rhs == 0)
+		return BigInt();
+
+	return BigInt::abs(BigInt::divexact(lhs, BigInt::gcd(lhs, rhs)) * rhs);
+}
+
 BigInt BigInt::mod_inverse(const BigInt& a, const BigInt& m)
 {
 	if (a > m) {
@@ -565,64 +1357,144 @@ BigInt BigInt::mod_inverse(const BigInt& a, const BigInt& m)
 	return x;
 }
 
-BigInt BigInt::left_shift(const BigInt& number, uint32_t shift) {
-	if (shift == 0)
-		return number;
-	uint32_t bit_shift = shift % 32;
-	uint32_t chunk_shift = shift / 32;
+BigInt BigInt::left_shift(const BigInt& number, uint64_t shift) {
+	BigInt result = number;
+	result <<= shift;
+	return result;
+}
 
-	std::list<uint32_t> chunks1(number._chunks.begin(), number._chunks.end());
+BigInt BigInt::right_shift(const BigInt& number, uint64_t shift) {
+	if (shift / 32 >= number._chunks.size())
+		return BigInt();
 
-	for (size_t i = 0; i < chunk_shift; i++)
-		chunks1.push_front(0);
+	BigInt result = BigInt::chunk_slice(number, (size_t)(shift / 32), number._chunks.size());
+	result >>= shift % 32;
+	result._is_negative = number._is_negative && !(result._chunks.size() == 1 && result._chunks[0] == 0);
+	return result;
+}
 
-	std::vector chunks2(chunks1.begin(), chunks1.end());
+uint32_t BigInt::complement_chunk(const BigInt& number, size_t index, size_t low_zeros) {
+	uint32_t chunk = index < number._chunks.size() ? number._chunks[index] : 0;
+	return (uint32_t)(~chunk + (index <= low_zeros ? 1 : 0));
+}
 
-	if (bit_shift > 0) {
-		uint32_t carry = 0;
-		for (size_t i = 0; i < chunks2.size(); i++) {
-			uint32_t new_carry = chunks2[i] >> (32 - bit_shift);
-			chunks2[i] = (chunks2[i] << bit_shift) | carry;
-			carry = new_carry;
+template <typename Op>
+BigInt BigInt::bitwise(const BigInt& lhs, const BigInt& rhs, Op op) {
+	bool lhs_negative = lhs._is_negative && !(lhs._chunks.size() == 1 && lhs._chunks[0] == 0);
+	bool rhs_negative = rhs._is_negative && !(rhs._chunks.size() == 1 && rhs._chunks[0] == 0);
+	bool is_negative = op(lhs_negative ? UINT32_MAX : 0, rhs_negative ? UINT32_MAX : 0) != 0;
+
+	size_t size = std::max(lhs._chunks.size(), rhs._chunks.size()) + 1;
+	std::vector<uint32_t> chunks(size);
+	uint64_t lhs_carry = lhs_negative ? 1 : 0;
+	uint64_t rhs_carry = rhs_negative ? 1 : 0;
+	uint64_t carry = is_negative ? 1 : 0;
+
+	for (size_t i = 0; i < size; i++) {
+		uint32_t lhs_chunk = i < lhs._chunks.size() ? lhs._chunks[i] : 0;
+		uint32_t rhs_chunk = i < rhs._chunks.size() ? rhs._chunks[i] : 0;
+		if (lhs_negative) {
+			lhs_carry += (uint32_t)~lhs_chunk;
+			lhs_chunk = (uint32_t)lhs_carry;
+			lhs_carry >>= 32;
 		}
-		if (carry != 0) {
-			chunks2.push_back(carry);
+		if (rhs_negative) {
+			rhs_carry += (uint32_t)~rhs_chunk;
+			rhs_chunk = (uint32_t)rhs_carry;
+			rhs_carry >>= 32;
+		}
+
+		uint32_t chunk = op(lhs_chunk, rhs_chunk);
+		if (is_negative) {
+			carry += (uint32_t)~chunk;
+			chunk = (uint32_t)carry;
+			carry >>= 32;
 		}
+		chunks[i] = chunk;
 	}
-	return BigInt(chunks2, number._is_negative);
-}
 
-BigInt BigInt::right_shift(const BigInt& number, uint32_t shift) {
-	if (shift == 0)
-		return number;
-	uint32_t bit_shift = shift % 32;
-	uint32_t chunk_shift = shift / 32;
+	while (chunks.size() > 1 && chunks.back() == 0)
+		chunks.pop_back();
 
-	std::list<uint32_t> chunks1(number._chunks.begin(), number._chunks.end());
+	return BigInt(chunks, is_negative && !(chunks.size() == 1 && chunks[0] == 0));
+}
 
-	for (size_t i = 0; i < chunk_shift; i++) {
-		chunks1.pop_front();
-		if (chunks1.size() == 0)
-			return BigInt();
+template <typename Op>
+void BigInt::bitwise_assign(const BigInt& other, Op op) {
+	const BigInt& number = *this;
+	bool lhs_negative = number._is_negative && !(number._chunks.size() == 1 && number._chunks[0] == 0);
+	bool rhs_negative = other._is_negative && !(other._chunks.size() == 1 && other._chunks[0] == 0);
+	if (lhs_negative || rhs_negative) {
+		*this = BigInt::bitwise(*this, other, op);
+		return;
 	}
 
-	std::vector chunks2(chunks1.begin(), chunks1.end());
+	size_t size = op(UINT32_MAX, 0) != 0 ? std::max(_chunks.size(), other._chunks.size()) : std::min(_chunks.size(), other._chunks.size());
+	_chunks.resize(size, 0);
+	uint32_t* chunks = _chunks.data();
+	size_t common = std::min(size, other._chunks.size());
+	for (size_t i = 0; i < common; i++)
+		chunks[i] = op(chunks[i], other._chunks[i]);
 
-	if (bit_shift > 0) {
-		uint32_t carry = 0;
-		for (int i = (int)chunks2.size() - 1; i >= 0; i--) {
-			uint32_t new_carry = chunks2[i] << (32 - bit_shift);
-			chunks2[i] = (chunks2[i] >> bit_shift) | carry;
-			carry = new_carry;
-		}
+	while (_chunks.size() > 1 && _chunks.back() == 0)
+		_chunks.pop_back();
+	_is_negative = false;
+}
+
+BigInt BigInt::bit_and(const BigInt& lhs, const BigInt& rhs) {
+	return BigInt::bitwise(lhs, rhs, [](uint32_t a, uint32_t b) { return a & b; });
+}
+
+BigInt BigInt::bit_or(const BigInt& lhs, const BigInt& rhs) {
+	return BigInt::bitwise(lhs, rhs, [](uint32_t a, uint32_t b) { return a | b; });
+}
+
+BigInt BigInt::bit_xor(const BigInt& lhs, const BigInt& rhs) {
+	return BigInt::bitwise(lhs, rhs, [](uint32_t a, uint32_t b) { return a ^ b; });
+}
+
+BigInt BigInt::bit_not(const BigInt& number) {
+	return BigInt::sub_scalar(-number, 1);
+}
+
+BigInt BigInt::low_bits(const BigInt& number, uint64_t count) {
+	bool is_negative = number._is_negative && !(number._chunks.size() == 1 && number._chunks[0] == 0);
+	uint64_t full_size = count / 32 + (count % 32 != 0 ? 1 : 0);
+	size_t size = is_negative ? BigInt::checked_size(full_size) : (size_t)std::min<uint64_t>(full_size, number._chunks.size());
+	if (size == 0)
+		return BigInt();
+
+	std::vector<uint32_t> chunks(size);
+	if (is_negative) {
+		size_t low_zeros = BigInt::low_zero_chunks(number);
+		for (size_t i = 0; i < size; i++)
+			chunks[i] = BigInt::complement_chunk(number, i, low_zeros);
 	}
-	return BigInt(chunks2, number._is_negative);
+	else {
+		std::copy(number._chunks.begin(), number._chunks.begin() + size, chunks.begin());
+	}
+
+	if (size == full_size && count % 32 != 0)
+		chunks.back() &= ((uint32_t)1 << (count % 32)) - 1;
+
+	while (chunks.size() > 1 && chunks.back() == 0)
+		chunks.pop_back();
+
+	return BigInt(chunks);
 }
 
 BigInt BigInt::montgomery(const BigInt& rhs, const BigInt& lhs,const BigInt& module, const BigInt& R, const BigInt& n_prime) {
-	BigInt x = rhs * lhs;
-	BigInt m = (x * n_prime) % R;
-	BigInt t = (x + m * module) / R;
+	BigInt x = (&rhs == &lhs) ? BigInt::karatsuba_square(rhs) : rhs * lhs;
+	BigInt t;
+	if (!R._is_negative && R.popcount() == 1) {
+		uint64_t r_bits = R.count_trailing_zeros();
+		BigInt m = BigInt::low_bits(x * n_prime, r_bits);
+		t = BigInt::right_shift(x + m * module, r_bits);
+	}
+	else {
+		BigInt m = (x * n_prime) % R;
+		t = BigInt::divexact(x + m * module, R);
+	}
 
 	if (t >= module)
 		t -= module;
@@ -632,7 +1504,7 @@ BigInt BigInt::montgomery(const BigInt& rhs, const BigInt& lhs,const BigInt& mod
 
 BigInt BigInt::montgomery_mul(const BigInt& rhs, const BigInt& lhs, const BigInt& module) { 
 	BigInt one = 1;
-	uint32_t n = module.bit_length();
+	uint64_t n = module.bit_length();
 	BigInt R = one << n;
 
 	BigInt n_prime = BigInt::mod_inverse(module, R);
@@ -667,7 +1539,7 @@ BigInt BigInt::binary_pow(const BigInt& number, const BigInt& degree) {
 	}
 
 	BigInt acc = number;
-	for (int i = (int)degree_bits.size() - 2; i >= 0; i--) {
+	for (size_t i = degree_bits.size() - 1; i-- > 0;) {
 		acc = BigInt::karatsuba_square(acc);
 		if (degree_bits[i] == 1)
 			acc *= number;
@@ -716,14 +1588,14 @@ BigInt BigInt::pow(const BigInt& number, const BigInt& degree, uint32_t base) {
 	}
 
 	acc = 1;
-	for (int i = (int)degree_bits.size() - 1; i >= 0; i -= bit_depth) {		
+	for (size_t i = degree_bits.size(); i > 0; i -= bit_depth) {		
 		for (size_t i = 0; i < bit_depth; i++) {
 			acc = BigInt::karatsuba_square(acc);
 		}
 
 		uint32_t factor_index = 0;
 		for (size_t j = 0; j < bit_depth; j++) {
-			factor_index |= (uint32_t)degree_bits[i - j] << (bit_depth - j - 1);
+			factor_index |= (uint32_t)degree_bits[i - 1 - j] << (bit_depth - j - 1);
 		}
 
 		acc *= factors[factor_index];
@@ -742,7 +1614,7 @@ BigInt BigInt::montgomery_pow(const BigInt& number, const BigInt& degree, const
 
 	BigInt zero;
 	BigInt one = 1;
-	uint32_t n = module.bit_length();
+	uint64_t n = module.bit_length();
 	BigInt R = one << n;
 	BigInt n_prime = R - BigInt::mod_inverse(module, R);
 
@@ -776,14 +1648,14 @@ BigInt BigInt::montgomery_pow(const BigInt& number, const BigInt& degree, const
 
 	acc = R1;
 
-	for (int i = (int)degree_bits.size() - 1; i >= 0; i -= bit_depth) {
+	for (size_t i = degree_bits.size(); i > 0; i -= bit_depth) {
 		for (uint32_t j = 0; j < bit_depth; ++j) {
 			acc = BigInt::montgomery(acc, acc, module, R, n_prime);
 		}
 
 		uint32_t factor_index = 0;
 		for (uint32_t j = 0; j < bit_depth; ++j) {
-			factor_index |= (uint32_t)degree_bits[i - j] << (bit_depth - j - 1);
+			factor_index |= (uint32_t)degree_bits[i - 1 - j] << (bit_depth - j - 1);
 		}
 
 		if (factor_index != 0) {
@@ -795,12 +1667,22 @@ BigInt BigInt::montgomery_pow(const BigInt& number, const BigInt& degree, const
 	return acc;
 }
 
+bool BigInt::shares_chunks(const BigInt& other) const {
+	return _chunks.stored().data() == other._chunks.stored().data();
+}
+
 BigInt& BigInt::operator =(const BigInt& other) {
 	_is_negative = other._is_negative;
 	_chunks = other._chunks;
 	return *this;
 }
 
+BigInt& BigInt::operator =(BigInt&& other) noexcept {
+	_is_negative = other._is_negative;
+	_chunks.swap(other._chunks);
+	return *this;
+}
+
 BigInt& BigInt::operator =(const std::string& number_str) {
 	*this = BigInt(number_str);
 	return *this;
@@ -822,7 +1704,7 @@ BigInt& BigInt::operator *=(const BigInt& other) {
 }
 
 BigInt& BigInt::operator /=(const BigInt& other) {
-	*this = *this + other;
+	*this = *this / other;
 	return *this;
 }
 
@@ -831,13 +1713,77 @@ BigInt& BigInt::operator %=(const BigInt& other) {
 	return *this;
 }
 
-BigInt& BigInt::operator >>=(uint32_t shift) {
-	*this = *this >> shift;
+BigInt& BigInt::operator >>=(uint64_t shift) {
+	if (shift == 0)
+		return *this;
+	if (shift / 32 >= _chunks.size())
+		return *this = BigInt();
+	size_t chunk_shift = (size_t)(shift / 32);
+	uint32_t bit_shift = shift % 32;
+
+	if (bit_shift > 0 && chunk_shift < _chunks.offset()) {
+		*this <<= 32 - bit_shift;
+		chunk_shift++;
+		bit_shift = 0;
+	}
+	if (chunk_shift <= _chunks.offset() && bit_shift == 0) {
+		_chunks.drop(chunk_shift);
+		return *this;
+	}
+
+	size_t skip = chunk_shift - _chunks.offset();
+	_chunks.drop(_chunks.offset());
+	std::vector<uint32_t>& chunks = _chunks.stored();
+	if (bit_shift > 0) {
+		for (size_t i = 0; i + skip + 1 < chunks.size(); i++)
+			chunks[i] = (chunks[i + skip] >> bit_shift) | (chunks[i + skip + 1] << (32 - bit_shift));
+		chunks[chunks.size() - skip - 1] = chunks.back() >> bit_shift;
+	}
+	else {
+		std::copy(chunks.begin() + skip, chunks.end(), chunks.begin());
+	}
+	chunks.resize(chunks.size() - skip);
+
+	while (chunks.size() > 1 && chunks.back() == 0)
+		chunks.pop_back();
+	if (chunks.size() == 1 && chunks[0] == 0)
+		_is_negative = false;
+	return *this;
+}
+
+BigInt& BigInt::operator <<=(uint64_t shift) {
+	if (shift == 0 || (_chunks.size() == 1 && _chunks[0] == 0))
+		return *this;
+	uint32_t bit_shift = shift % 32;
+	size_t chunk_shift = BigInt::checked_size(shift / 32 + _chunks.size() + 1) - _chunks.size() - 1;
+
+	if (bit_shift > 0) {
+		std::vector<uint32_t>& chunks = _chunks.stored();
+		uint32_t carry = 0;
+		for (uint32_t& chunk : chunks) {
+			uint32_t next = chunk >> (32 - bit_shift);
+			chunk = (chunk << bit_shift) | carry;
+			carry = next;
+		}
+		if (carry != 0)
+			chunks.push_back(carry);
+	}
+	_chunks.shift(chunk_shift);
 	return *this;
 }
 
-BigInt& BigInt::operator <<=(uint32_t shift) {
-	*this = *this << shift;
+BigInt& BigInt::operator &=(const BigInt& other) {
+	bitwise_assign(other, [](uint32_t a, uint32_t b) { return a & b; });
+	return *this;
+}
+
+BigInt& BigInt::operator |=(const BigInt& other) {
+	bitwise_assign(other, [](uint32_t a, uint32_t b) { return a | b; });
+	return *this;
+}
+
+BigInt& BigInt::operator ^=(const BigInt& other) {
+	bitwise_assign(other, [](uint32_t a, uint32_t b) { return a ^ b; });
 	return *this;
 }
 
@@ -856,6 +1802,8 @@ BigInt BigInt::operator -() const {
 }
 
 BigInt BigInt::operator *(const BigInt& other) const {
+	if (this == &other)
+		return BigInt::karatsuba_square(*this);
 	return BigInt::karatsuba_mul(*this, other);
 }
 
@@ -867,17 +1815,32 @@ BigInt BigInt::operator %(const BigInt& other) const {
 	return BigInt::mod(*this, other);
 }
 
-BigInt BigInt::operator >>(uint32_t shift) const {
+BigInt BigInt::operator &(const BigInt& other) const {
+	return BigInt::bit_and(*this, other);
+}
+
+BigInt BigInt::operator |(const BigInt& other) const {
+	return BigInt::bit_or(*this, other);
+}
+
+BigInt BigInt::operator ^(const BigInt& other) const {
+	return BigInt::bit_xor(*this, other);
+}
+
+BigInt BigInt::operator ~() const {
+	return BigInt::bit_not(*this);
+}
+
+BigInt BigInt::operator >>(uint64_t shift) const {
 	return BigInt::right_shift(*this, shift);
 }
 
-BigInt BigInt::operator <<(uint32_t shift) const {
+BigInt BigInt::operator <<(uint64_t shift) const {
 	return BigInt::left_shift(*this, shift);
 }
 
 bool BigInt::operator ==(const BigInt& other) const {
-	BigInt zero;
-	if (_chunks == zero._chunks && other._chunks == zero._chunks)
+	if (_chunks.size() == 1 && _chunks[0] == 0 && other._chunks.size() == 1 && other._chunks[0] == 0)
 		return true;
 	return BigInt::abs_cmp(*this, other) == 0 && _is_negative == other._is_negative;
 }
@@ -895,7 +1858,7 @@ bool BigInt::operator >(const BigInt& other) const {
 	if (!_is_negative && other._is_negative)
 		return true;
 
-	int check = BigInt::abs_cmp(*this, other) > 0;
+	int check = BigInt::abs_cmp(*this, other);
 	if (check < 0 && _is_negative || check > 0 && !_is_negative)
 		return true;
 	return false;
@@ -0,0 +1,573 @@
+﻿#include <bintmod.h>
+
+static uint32_t window_digit(const ChunkBuffer& degree_chunks, uint64_t position, uint32_t bit_depth) {
+	uint32_t index = 0;
+	for (uint32_t j = bit_depth; j-- > 0;) {
+		uint64_t bit = position + j;
+		index <<= 1;
+		if (bit / 32 < degree_chunks.size())
+			index |= (degree_chunks[bit / 32] >> (bit % 32)) & 1;
+	}
+	return index;
+}
+
+template <typename Context>
+static BigInt window_pow(const Context& context, const BigInt& one, const BigInt& number, const BigInt& degree, const ChunkBuffer& degree_chunks, uint32_t base) {
+	if (degree < 0)
+		throw std::invalid_argument("Raising to a negative power");
+	if (base == 0 || (base & (base - 1)) != 0)
+		throw std::invalid_argument("Base is not a power of 2");
+	if (base == 1)
+		throw std::invalid_argument("Base cannot be equal to 1");
+
+	uint32_t bit_depth = 31 - BigInt::leading_zeros(base);
+	uint64_t bit_count = degree.bit_length();
+	if (bit_count == 0)
+		return one;
+
+	std::vector<BigInt> factors;
+	factors.reserve(base);
+	factors.push_back(one);
+	factors.push_back(number);
+	for (size_t i = 2; i < base; ++i)
+		factors.push_back(context.mul(factors.back(), number));
+
+	uint64_t windows = (bit_count + bit_depth - 1) / bit_depth;
+	BigInt acc = factors[window_digit(degree_chunks, (windows - 1) * bit_depth, bit_depth)];
+
+	for (uint64_t i = windows - 1; i-- > 0;) {
+		for (uint32_t j = 0; j < bit_depth; ++j)
+			acc = context.sqr(acc);
+
+		uint32_t index = window_digit(degree_chunks, i * bit_depth, bit_depth);
+		if (index != 0)
+			acc = context.mul(acc, factors[index]);
+	}
+
+	return acc;
+}
+
+template <typename Context>
+static BigInt window_multi_pow(const Context& context, const BigInt& one, const std::vector<BigInt>& numbers, const std::vector<BigInt>& degrees, const std::vector<ChunkBuffer>& degree_chunks) {
+	uint64_t bit_count = 0;
+	for (auto& degree : degrees)
+		bit_count = std::max(bit_count, degree.bit_length());
+	if (bit_count == 0)
+		return one;
+
+	uint32_t bit_depth = bit_count <= 64 ? 2 : bit_count <= 256 ? 3 : bit_count <= 1024 ? 4 : 5;
+	uint32_t base = 1u << bit_depth;
+
+	std::vector<std::vector<BigInt>> factors(numbers.size());
+	for (size_t k = 0; k < numbers.size(); ++k) {
+		if (degrees[k] == 0)
+			continue;
+		factors[k].reserve(base);
+		factors[k].push_back(one);
+		factors[k].push_back(numbers[k]);
+		for (size_t i = 2; i < base; ++i)
+			factors[k].push_back(context.mul(factors[k].back(), numbers[k]));
+	}
+
+	uint64_t windows = (bit_count + bit_depth - 1) / bit_depth;
+	BigInt acc = one;
+	bool is_one = true;
+
+	for (uint64_t i = windows; i-- > 0;) {
+		if (!is_one)
+			for (uint32_t j = 0; j < bit_depth; ++j)
+				acc = context.sqr(acc);
+
+		for (size_t k = 0; k < numbers.size(); ++k) {
+			if (factors[k].empty())
+				continue;
+			uint32_t index = window_digit(degree_chunks[k], i * bit_depth, bit_depth);
+			if (index != 0) {
+				acc = is_one ? factors[k][index] : context.mul(acc, factors[k][index]);
+				is_one = false;
+			}
+		}
+	}
+
+	return acc;
+}
+
+MontgomeryContext::MontgomeryContext(const BigInt& module) : _module(module), _size(module._chunks.size()), _m_inv(0) {
+	if (module <= 1 || (module._chunks[0] & 1) == 0)
+		throw std::invalid_argument("Module must be odd and greater than one");
+
+	uint32_t inv = module._chunks[0];
+	for (size_t i = 0; i < 4; i++)
+		inv *= 2 - module._chunks[0] * inv;
+	_m_inv = 0 - inv;
+
+	BigInt one = 1;
+	_r1 = (one << (uint64_t)(32 * _size)) % module;
+	_r2 = BigInt::karatsuba_square(_r1) % module;
+}
+
+const BigInt& MontgomeryContext::module() const {
+	return _module;
+}
+
+size_t MontgomeryContext::size() const {
+	return _size;
+}
+
+const BigInt& MontgomeryContext::one() const {
+	return _r1;
+}
+
+BigInt MontgomeryContext::reduce(const BigInt& number) const {
+	const std::vector<uint32_t>& module = _module._chunks.stored();
+
+	std::vector<uint32_t> chunks = number._chunks.to_vector();
+	chunks.resize(std::max(chunks.size(), 2 * _size) + 1, 0);
+
+	for (size_t i = 0; i < _size; ++i) {
+		uint32_t u = chunks[i] * _m_inv;
+		uint64_t carry = 0;
+
+		for (size_t j = 0; j < _size; ++j) {
+			uint64_t sum = (uint64_t)u * module[j] + chunks[i + j] + carry;
+			chunks[i + j] = (uint32_t)sum;
+			carry = sum >> 32;
+		}
+
+		for (size_t j = i + _size; carry != 0; ++j) {
+			uint64_t sum = (uint64_t)chunks[j] + carry;
+			chunks[j] = (uint32_t)sum;
+			carry = sum >> 32;
+		}
+	}
+
+	std::vector<uint32_t> res_chunks(chunks.begin() + _size, chunks.end());
+	while (res_chunks.size() > 1 && res_chunks.back() == 0)
+		res_chunks.pop_back();
+
+	BigInt result(res_chunks);
+	while (result >= _module)
+		result -= _module;
+
+	return result;
+}
+
+BigInt MontgomeryContext::to_montgomery(const BigInt& number) const {
+	if (number < 0 || number >= _module)
+		return reduce(BigInt::mod(number, _module) * _r2);
+	return reduce(number * _r2);
+}
+
+BigInt MontgomeryContext::from_montgomery(const BigInt& number) const {
+	return reduce(number);
+}
+
+BigInt MontgomeryContext::add(const BigInt& lhs, const BigInt& rhs) const {
+	BigInt result = lhs + rhs;
+	if (result >= _module)
+		result -= _module;
+	return result;
+}
+
+BigInt MontgomeryContext::sub(const BigInt& lhs, const BigInt& rhs) const {
+	BigInt result = lhs - rhs;
+	if (result < 0)
+		result += _module;
+	return result;
+}
+
+BigInt MontgomeryContext::mul(const BigInt& lhs, const BigInt& rhs) const {
+	if (&lhs == &rhs)
+		return sqr(lhs);
+	return reduce(lhs * rhs);
+}
+
+BigInt MontgomeryContext::sqr(const BigInt& number) const {
+	return reduce(BigInt::karatsuba_square(number));
+}
+
+BigInt MontgomeryContext::pow(const BigInt& number, const BigInt& degree, uint32_t base) const {
+	return window_pow(*this, _r1, number, degree, degree._chunks, base);
+}
+
+BarrettContext::BarrettContext(const BigInt& module) : _module(module), _size(module._chunks.size()) {
+	if (module <= 1)
+		throw std::invalid_argument("Module must be greater than one");
+
+	BigInt one = 1;
+	_mu = (one << (uint64_t)(64 * _size)) / module;
+}
+
+const BigInt& BarrettContext::module() const {
+	return _module;
+}
+
+size_t BarrettContext::size() const {
+	return _size;
+}
+
+BigInt BarrettContext::reduce(const BigInt& number) const {
+	if (number._chunks.size() > 2 * _size)
+		return BigInt::mod(number, _module);
+
+	auto slice = [](const ChunkBuffer& chunks, size_t from, size_t to) {
+		to = std::min(to, chunks.size());
+		if (from >= to)
+			return BigInt();
+
+		std::vector<uint32_t> res_chunks(chunks.begin() + from, chunks.begin() + to);
+		while (res_chunks.size() > 1 && res_chunks.back() == 0)
+			res_chunks.pop_back();
+		return BigInt(res_chunks);
+	};
+
+	BigInt q1 = slice(number._chunks, _size - 1, number._chunks.size());
+	BigInt q2 = q1 * _mu;
+	BigInt q3 = slice(q2._chunks, _size + 1, q2._chunks.size());
+
+	BigInt r1 = slice(number._chunks, 0, _size + 1);
+	BigInt r2 = slice((q3 * _module)._chunks, 0, _size + 1);
+	BigInt r = r1 - r2;
+	if (r < 0) {
+		BigInt one = 1;
+		r += one << (uint64_t)(32 * (_size + 1));
+	}
+
+	while (r >= _module)
+		r -= _module;
+
+	if (number._is_negative && r != 0)
+		r = _module - r;
+
+	return r;
+}
+
+BigInt BarrettContext::mul(const BigInt& lhs, const BigInt& rhs) const {
+	if (&lhs == &rhs)
+		return sqr(lhs);
+	return reduce(lhs * rhs);
+}
+
+BigInt BarrettContext::sqr(const BigInt& number) const {
+	return reduce(BigInt::karatsuba_square(number));
+}
+
+BigInt BarrettContext::pow(const BigInt& number, const BigInt& degree, uint32_t base) const {
+	return window_pow(*this, reduce(1), reduce(number), degree, degree._chunks, base);
+}
+
+BigInt BigInt::mod(const BigInt& lhs, const BarrettContext& context) {
+	return context.reduce(lhs);
+}
+
+BigInt BigInt::operator %(const BarrettContext& context) const {
+	return context.reduce(*this);
+}
+
+BigInt& BigInt::operator %=(const BarrettContext& context) {
+	*this = context.reduce(*this);
+	return *this;
+}
+
+FixedBaseExp::FixedBaseExp(const BigInt& number, const BigInt& module, uint64_t max_bits, uint32_t window) : _context(module), _number(number), _max_bits(max_bits), _window(window) {
+	if (window == 0 || window > 16)
+		throw std::invalid_argument("Window must be between 1 and 16 bits");
+	if (max_bits == 0)
+		throw std::invalid_argument("Maximum exponent size must be positive");
+
+	size_t rows = (max_bits + window - 1) / window;
+	size_t columns = ((size_t)1 << window) - 1;
+	_table.reserve(rows * columns);
+
+	BigInt row_base = _context.to_montgomery(number);
+	for (size_t i = 0; i < rows; ++i) {
+		_table.push_back(row_base);
+		for (size_t j = 1; j < columns; ++j)
+			_table.push_back(_context.mul(_table.back(), row_base));
+		row_base = _context.mul(_table.back(), row_base);
+	}
+}
+
+const MontgomeryContext& FixedBaseExp::context() const {
+	return _context;
+}
+
+uint64_t FixedBaseExp::max_bits() const {
+	return _max_bits;
+}
+
+uint32_t FixedBaseExp::window() const {
+	return _window;
+}
+
+size_t FixedBaseExp::table_size() const {
+	return _table.size();
+}
+
+BigInt FixedBaseExp::pow(const BigInt& degree) const {
+	if (degree < 0)
+		throw std::invalid_argument("Raising to a negative power");
+	if (degree.bit_length() > _max_bits)
+		return _context.from_montgomery(_context.pow(_context.to_montgomery(_number), degree));
+
+	const ChunkBuffer& degree_chunks = degree._chunks;
+	size_t columns = ((size_t)1 << _window) - 1;
+	uint64_t rows = (degree.bit_length() + _window - 1) / _window;
+
+	BigInt acc = _context.one();
+	for (uint64_t i = 0; i < rows; ++i) {
+		uint32_t index = window_digit(degree_chunks, i * _window, _window);
+		if (index != 0)
+			acc = _context.mul(acc, _table[i * columns + index - 1]);
+	}
+
+	return _context.from_montgomery(acc);
+}
+
+BigInt BigInt::multi_pow_mod(const std::vector<BigInt>& numbers, const std::vector<BigInt>& degrees, const BigInt& module) {
+	if (numbers.size() != degrees.size())
+		throw std::invalid_argument("Numbers and degrees must have the same size");
+	for (auto& degree : degrees)
+		if (degree < 0)
+			throw std::invalid_argument("Raising to a negative power");
+	if (module <= 1)
+		throw std::invalid_argument("Module must be greater than one");
+
+	std::vector<ChunkBuffer> degree_chunks;
+	degree_chunks.reserve(degrees.size());
+	for (auto& degree : degrees)
+		degree_chunks.push_back(degree._chunks);
+
+	if ((module._chunks[0] & 1) != 0) {
+		MontgomeryContext context(module);
+		std::vector<BigInt> montgomery_numbers;
+		montgomery_numbers.reserve(numbers.size());
+		for (auto& number : numbers)
+			montgomery_numbers.push_back(context.to_montgomery(number));
+		return context.from_montgomery(window_multi_pow(context, context.one(), montgomery_numbers, degrees, degree_chunks));
+	}
+
+	ReductionContext context(module);
+	std::vector<BigInt> reduced_numbers;
+	reduced_numbers.reserve(numbers.size());
+	for (auto& number : numbers)
+		reduced_numbers.push_back(context.reduce(number));
+	return window_multi_pow(context, context.reduce(1), reduced_numbers, degrees, degree_chunks);
+}
+
+ReductionContext::ReductionContext(const BigInt& module, size_t max_terms) : _module(module), _form(Form::barrett), _bits(0), _c(0), _c_negative(false) {
+	if (module <= 1)
+		throw std::invalid_argument("Module must be greater than one");
+
+	BigInt one = 1;
+	uint64_t bits = module.bit_length();
+	BigInt below = (one << bits) - module;
+	BigInt above = module - (one << (bits - 1));
+
+	if (!detect(bits, below, false, max_terms) && !detect(bits - 1, above, true, max_terms))
+		_barrett.emplace(module);
+}
+
+bool ReductionContext::detect(uint64_t bits, const BigInt& c, bool c_negative, size_t max_terms) {
+	if (bits < 64 || c == 0)
+		return false;
+
+	if (c._chunks.size() == 1) {
+		_form = Form::pseudo_mersenne;
+		_bits = bits;
+		_c = c._chunks[0];
+		_c_negative = c_negative;
+		return true;
+	}
+
+	std::vector<std::pair<uint64_t, bool>> terms;
+	BigInt rest = c;
+	for (uint64_t position = 0; rest != 0; position++) {
+		if ((rest._chunks[0] & 1) != 0) {
+			bool is_negative = (rest._chunks[0] & 3) == 3;
+			terms.push_back({ position, is_negative ^ c_negative });
+			rest = is_negative ? rest + 1 : rest - 1;
+			if (terms.size() > max_terms)
+				return false;
+		}
+		rest >>= 1;
+	}
+
+	if (terms.back().first + 32 > bits)
+		return false;
+
+	_form = Form::solinas;
+	_bits = bits;
+	_terms = terms;
+	return true;
+}
+
+void ReductionContext::split(const BigInt& number, uint64_t bits, BigInt& high, BigInt& low) {
+	size_t chunk_shift = (size_t)std::min<uint64_t>(bits / 32, number._chunks.size());
+	uint32_t bit_shift = bits % 32;
+	const ChunkBuffer& chunks = number._chunks;
+
+	std::vector<uint32_t> low_chunks(chunks.begin(), chunks.begin() + std::min(chunks.size(), chunk_shift + (bit_shift > 0 ? 1 : 0)));
+	if (bit_shift > 0 && low_chunks.size() > chunk_shift)
+		low_chunks[chunk_shift] &= (1u << bit_shift) - 1;
+	while (low_chunks.size() > 1 && low_chunks.back() == 0)
+		low_chunks.pop_back();
+
+	std::vector<uint32_t> high_chunks;
+	if (chunks.size() > chunk_shift) {
+		high_chunks.reserve(chunks.size() - chunk_shift);
+		for (size_t i = chunk_shift; i < chunks.size(); i++) {
+			uint32_t chunk = chunks[i] >> bit_shift;
+			if (bit_shift > 0 && i + 1 < chunks.size())
+				chunk |= chunks[i + 1] << (32 - bit_shift);
+			high_chunks.push_back(chunk);
+		}
+	}
+	while (high_chunks.size() > 1 && high_chunks.back() == 0)
+		high_chunks.pop_back();
+
+	high = BigInt(high_chunks);
+	low = BigInt(low_chunks);
+}
+
+const BigInt& ReductionContext::module() const {
+	return _module;
+}
+
+ReductionContext::Form ReductionContext::form() const {
+	return _form;
+}
+
+BigInt ReductionContext::reduce(const BigInt& number) const {
+	if (_form == Form::barrett)
+		return _barrett->reduce(number);
+
+	BigInt result = BigInt::abs(number);
+	BigInt high, low;
+
+	while (result.bit_length() > _bits) {
+		bool is_negative = result._is_negative;
+		split(result, _bits, high, low);
+
+		if (_form == Form::pseudo_mersenne) {
+			result = _c_negative ? low - high * _c : low + high * _c;
+		}
+		else {
+			result = low;
+			for (auto& [position, term_negative] : _terms)
+				result = term_negative ? result - (high << position) : result + (high << position);
+		}
+
+		if (is_negative)
+			result = -result;
+	}
+
+	while (result < 0)
+		result += _module;
+	while (result >= _module)
+		result -= _module;
+
+	if (number._is_negative && result != 0)
+		result = _module - result;
+
+	return result;
+}
+
+BigInt ReductionContext::mul(const BigInt& lhs, const BigInt& rhs) const {
+	if (&lhs == &rhs)
+		return sqr(lhs);
+	return reduce(lhs * rhs);
+}
+
+BigInt ReductionContext::sqr(const BigInt& number) const {
+	return reduce(BigInt::karatsuba_square(number));
+}
+
+BigInt ReductionContext::pow(const BigInt& number, const BigInt& degree, uint32_t base) const {
+	return window_pow(*this, reduce(1), reduce(number), degree, degree._chunks, base);
+}
+
+ModInt::ModInt(const std::shared_ptr<const MontgomeryContext>& context, const BigInt& value, bool is_montgomery) : _context(context) {
+	_value = is_montgomery ? value : context->to_montgomery(value);
+}
+
+ModInt::ModInt(const std::shared_ptr<const MontgomeryContext>& context, const BigInt& number) : ModInt(context, number, false) {}
+
+ModInt ModInt::from_montgomery(const std::shared_ptr<const MontgomeryContext>& context, const BigInt& value) {
+	return ModInt(context, value, true);
+}
+
+void ModInt::check_context(const ModInt& other) const {
+	if (_context != other._context && _context->module() != other._context->module())
+		throw std::invalid_argument("Operands belong to different modules");
+}
+
+const std::shared_ptr<const MontgomeryContext>& ModInt::context() const {
+	return _context;
+}
+
+const BigInt& ModInt::montgomery_value() const {
+	return _value;
+}
+
+BigInt ModInt::value() const {
+	return _context->from_montgomery(_value);
+}
+
+ModInt ModInt::pow(const BigInt& degree) const {
+	return ModInt(_context, _context->pow(_value, degree), true);
+}
+
+ModInt ModInt::inverse() const {
+	return ModInt(_context, BigInt::mod_inverse(value(), _context->module()), false);
+}
+
+ModInt& ModInt::operator +=(const ModInt& other) {
+	check_context(other);
+	_value = _context->add(_value, other._value);
+	return *this;
+}
+
+ModInt& ModInt::operator -=(const ModInt& other) {
+	check_context(other);
+	_value = _context->sub(_value, other._value);
+	return *this;
+}
+
+ModInt& ModInt::operator *=(const ModInt& other) {
+	check_context(other);
+	_value = _context->mul(_value, other._value);
+	return *this;
+}
+
+ModInt ModInt::operator +(const ModInt& other) const {
+	check_context(other);
+	return ModInt(_context, _context->add(_value, other._value), true);
+}
+
+ModInt ModInt::operator -(const ModInt& other) const {
+	check_context(other);
+	return ModInt(_context, _context->sub(_value, other._value), true);
+}
+
+ModInt ModInt::operator -() const {
+	return ModInt(_context, _context->sub(0, _value), true);
+}
+
+ModInt ModInt::operator *(const ModInt& other) const {
+	check_context(other);
+	return ModInt(_context, _context->mul(_value, other._value), true);
+}
+
+bool ModInt::operator ==(const ModInt& other) const {
+	return _context->module() == other._context->module() && _value == other._value;
+}
+
+bool ModInt::operator !=(const ModInt& other) const {
+	return !(*this == other);
+}
+
+std::ostream& operator <<(std::ostream& os, const ModInt& number) {
+	os << number.value();
+	return os;
+}
@@ -0,0 +1,319 @@
+﻿#include <bintprime.h>
+#include <bintrandom.h>
+#include <atomic>
+#include <future>
+#include <thread>
+
+std::vector<uint32_t> Primality::sieve(uint64_t limit) {
+	limit = std::min<uint64_t>(limit, (uint64_t)UINT32_MAX + 1);
+	std::vector<bool> composite((size_t)limit, false);
+	std::vector<uint32_t> primes;
+
+	for (uint64_t i = 2; i < limit; ++i) {
+		if (composite[i])
+			continue;
+		primes.push_back((uint32_t)i);
+		for (uint64_t j = (uint64_t)i * i; j < limit; j += i)
+			composite[j] = true;
+	}
+
+	return primes;
+}
+
+const std::vector<uint32_t>& Primality::small_primes() {
+	static const std::vector<uint32_t> primes = Primality::sieve(SIEVE_LIMIT);
+	return primes;
+}
+
+const std::vector<std::pair<uint64_t, size_t>>& Primality::small_prime_groups() {
+	static const std::vector<std::pair<uint64_t, size_t>> groups = [] {
+		const std::vector<uint32_t>& primes = Primality::small_primes();
+		std::vector<std::pair<uint64_t, size_t>> result;
+
+		for (size_t i = 1; i < primes.size(); ++i) {
+			if (result.empty() || result.back().first > UINT64_MAX / primes[i])
+				result.push_back({ 1, 0 });
+			result.back().first *= primes[i];
+			result.back().second++;
+		}
+
+		return result;
+	}();
+	return groups;
+}
+
+uint32_t Primality::trial_division(const BigInt& number, uint32_t bound) {
+	BigInt n = BigInt::abs(number);
+	if (n < 2)
+		return 0;
+	if ((n._chunks[0] & 1) == 0)
+		return n == 2 ? 0 : 2;
+
+	const std::vector<uint32_t>& primes = Primality::small_primes();
+	size_t index = 1;
+
+	for (auto& [product, count] : Primality::small_prime_groups()) {
+		if (primes[index] > bound)
+			break;
+
+		uint64_t remainder = BigInt::mod_scalar(n, product);
+		for (size_t i = index; i < index + count && primes[i] <= bound; ++i) {
+			if (remainder % primes[i] == 0 && n != primes[i])
+				return primes[i];
+		}
+		index += count;
+	}
+
+	return 0;
+}
+
+int Primality::jacobi(const BigInt& a, const BigInt& n) {
+	if (n <= 0 || (n._chunks[0] & 1) == 0)
+		throw std::invalid_argument("Jacobi symbol requires an odd positive module");
+
+	BigInt lhs = BigInt::mod(a, n);
+	BigInt rhs = n;
+	int result = 1;
+
+	while (lhs != 0) {
+		uint64_t zeros = lhs.count_trailing_zeros();
+		lhs = lhs >> zeros;
+
+		uint32_t rhs_mod8 = rhs._chunks[0] & 7;
+		if ((zeros & 1) != 0 && (rhs_mod8 == 3 || rhs_mod8 == 5))
+			result = -result;
+
+		std::swap(lhs, rhs);
+		if ((lhs._chunks[0] & 3) == 3 && (rhs._chunks[0] & 3) == 3)
+			result = -result;
+		lhs = lhs % rhs;
+	}
+
+	return rhs == 1 ? result : 0;
+}
+
+bool Primality::is_square(const BigInt& number) {
+	if (number < 0)
+		return false;
+	if (number < 2)
+		return true;
+
+	uint32_t low = number._chunks[0] & 63;
+	if (low != 0 && low != 1 && low != 4 && low != 9 && low != 16 && low != 17 && low != 25 && low != 33 && low != 36 && low != 41 && low != 49 && low != 57)
+		return false;
+
+	return BigInt::sqrt_rem(number).second == 0;
+}
+
+bool Primality::miller_rabin_witness(const MontgomeryContext& context, const BigInt& witness, const BigInt& odd_part, uint64_t two_power) {
+	BigInt minus_one = context.sub(0, context.one());
+	BigInt x = context.pow(context.to_montgomery(witness), odd_part);
+
+	if (x == context.one() || x == minus_one)
+		return true;
+
+	for (uint64_t r = 1; r < two_power; ++r) {
+		x = context.sqr(x);
+		if (x == minus_one)
+			return true;
+		if (x == context.one())
+			return false;
+	}
+
+	return false;
+}
+
+bool Primality::miller_rabin(const BigInt& number, const std::vector<BigInt>& witnesses) {
+	if (number < 2)
+		return false;
+	if (number < 4)
+		return true;
+	if ((number._chunks[0] & 1) == 0)
+		return false;
+
+	BigInt odd_part = number - 1;
+	uint64_t two_power = odd_part.count_trailing_zeros();
+	odd_part = odd_part >> two_power;
+
+	MontgomeryContext context(number);
+	BigInt minus_one = number - 1;
+
+	for (auto& witness : witnesses) {
+		BigInt a = BigInt::mod(witness, number);
+		if (a < 2 || a == minus_one)
+			continue;
+		if (!Primality::miller_rabin_witness(context, a, odd_part, two_power))
+			return false;
+	}
+
+	return true;
+}
+
+bool Primality::miller_rabin(const BigInt& number, size_t rounds, uint64_t seed) {
+	if (number < 5)
+		return Primality::miller_rabin(number, std::vector<BigInt>());
+
+	BigIntRandom generator(seed);
+	BigInt bound = number - 1;
+	std::vector<BigInt> witnesses;
+	witnesses.reserve(rounds);
+
+	for (size_t i = 0; i < rounds; ++i)
+		witnesses.push_back(generator.range(2, bound));
+
+	return Primality::miller_rabin(number, witnesses);
+}
+
+bool Primality::strong_lucas(const BigInt& number) {
+	if (number < 2)
+		return false;
+	if (number == 2)
+		return true;
+	if ((number._chunks[0] & 1) == 0)
+		return false;
+
+	int64_t d = 5;
+	for (size_t attempt = 0;; ++attempt) {
+		int j = Primality::jacobi(BigInt::from_scalar(BigInt::scalar_abs(d), d < 0), number);
+		if (j == -1)
+			break;
+		if (j == 0 && BigInt::abs_cmp_scalar(number, BigInt::scalar_abs(d)) != 0)
+			return false;
+		if (attempt == 8 && Primality::is_square(number))
+			return false;
+		d = d > 0 ? -(d + 2) : -d + 2;
+	}
+
+	BarrettContext context(number);
+	int64_t q_value = (1 - d) / 4;
+	BigInt q = BigInt::mod(BigInt::from_scalar(BigInt::scalar_abs(q_value), q_value < 0), number);
+
+	BigInt degree = number + 1;
+	uint64_t two_power = degree.count_trailing_zeros();
+	degree = degree >> two_power;
+
+	auto half = [&](const BigInt& value) {
+		BigInt result = BigInt::mod(value, number);
+		if ((result._chunks[0] & 1) != 0)
+			result += number;
+		return result >> 1;
+	};
+
+	BigInt u = 1;
+	BigInt v = 1;
+	BigInt qk = q;
+
+	for (uint64_t i = degree.bit_length() - 1; i-- > 0;) {
+		u = context.mul(u, v);
+		v = context.reduce(BigInt::karatsuba_square(v) - (qk << 1));
+		qk = context.sqr(qk);
+
+		if ((degree._chunks[i / 32] >> (i % 32) & 1) != 0) {
+			BigInt next_u = half(u + v);
+			v = half(u * d + v);
+			u = next_u;
+			qk = context.mul(qk, q);
+		}
+	}
+
+	if (u == 0 || v == 0)
+		return true;
+
+	for (uint64_t r = 1; r < two_power; ++r) {
+		v = context.reduce(BigInt::karatsuba_square(v) - (qk << 1));
+		if (v == 0)
+			return true;
+		qk = context.sqr(qk);
+	}
+
+	return false;
+}
+
+bool Primality::bpsw(const BigInt& number) {
+	if (number < 2)
+		return false;
+	if (Primality::trial_division(number) != 0)
+		return false;
+	if (number < (uint64_t)TRIAL_DIVISION_BOUND * TRIAL_DIVISION_BOUND)
+		return true;
+
+	return Primality::miller_rabin(number, { BigInt(2) }) && Primality::strong_lucas(number);
+}
+
+bool Primality::is_probable_prime(const BigInt& number, size_t rounds) {
+	return Primality::bpsw(number) && (rounds == 0 || Primality::miller_rabin(number, rounds));
+}
+
+BigInt Primality::random_prime(uint64_t bits, uint64_t seed, size_t threads) {
+	if (bits < 2)
+		throw std::invalid_argument("Prime must have at least 2 bits");
+
+	BigIntRandom generator(seed);
+	auto random_start = [&]() {
+		BigInt result = generator.exact_bits(bits);
+		if ((result._chunks[0] & 1) == 0)
+			result += 1;
+		return result;
+	};
+
+	if (bits <= 32) {
+		while (true) {
+			BigInt candidate = bits == 2 ? BigInt((uint32_t)(2 + (generator() & 1))) : random_start();
+			if (Primality::bpsw(candidate))
+				return candidate;
+		}
+	}
+
+	if (threads == 0)
+		threads = std::max(1u, std::thread::hardware_concurrency());
+
+	const std::vector<uint32_t>& primes = Primality::small_primes();
+	BigInt start = random_start();
+
+	while (true) {
+		if ((start + 2 * SIEVE_WINDOW).bit_length() > bits)
+			start = random_start();
+
+		std::vector<bool> composite(SIEVE_WINDOW, false);
+		size_t index = 1;
+		for (auto& [product, count] : Primality::small_prime_groups()) {
+			uint64_t remainder = BigInt::mod_scalar(start, product);
+			for (size_t i = index; i < index + count; ++i) {
+				uint64_t p = primes[i];
+				uint64_t offset = (p - remainder % p) % p * ((p + 1) / 2) % p;
+				for (uint64_t j = offset; j < SIEVE_WINDOW; j += p)
+					composite[j] = true;
+			}
+			index += count;
+		}
+
+		std::vector<size_t> candidates;
+		for (size_t i = 0; i < SIEVE_WINDOW; ++i)
+			if (!composite[i])
+				candidates.push_back(i);
+
+		std::atomic<size_t> found(candidates.size());
+		auto worker = [&](size_t first) {
+			for (size_t i = first; i < candidates.size() && i < found.load(); i += threads) {
+				BigInt candidate = start + 2 * candidates[i];
+				if (Primality::miller_rabin(candidate, { BigInt(2) }) && Primality::strong_lucas(candidate)) {
+					size_t current = found.load();
+					while (i < current && !found.compare_exchange_weak(current, i));
+					return;
+				}
+			}
+		};
+
+		std::vector<std::future<void>> workers;
+		for (size_t t = 1; t < threads; ++t)
+			workers.push_back(std::async(std::launch::async, worker, t));
+		worker(0);
+		for (auto& future : workers)
+			future.get();
+
+		if (found.load() < candidates.size())
+			return start + 2 * candidates[found.load()];
+
+		start += 2 * SIEVE_WINDOW;
+	}
+}
@@ -0,0 +1,109 @@
+﻿#include <bintrandom.h>
+#include <random>
+
+uint64_t BigIntRandom::splitmix64(uint64_t& state) {
+	uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+	return z ^ (z >> 31);
+}
+
+BigIntRandom::BigIntRandom(uint64_t seed) {
+	this->seed(seed);
+}
+
+BigIntRandom::BigIntRandom(const EntropySource& entropy) {
+	this->seed(entropy);
+}
+
+void BigIntRandom::seed(uint64_t seed) {
+	for (auto& state : _state)
+		state = BigIntRandom::splitmix64(seed);
+}
+
+void BigIntRandom::seed(const EntropySource& entropy) {
+	if (!entropy) {
+		std::random_device device;
+		this->seed(((uint64_t)device() << 32) | device());
+		return;
+	}
+
+	for (auto& state : _state) {
+		uint64_t value = entropy();
+		state = BigIntRandom::splitmix64(value);
+	}
+}
+
+BigIntRandom::result_type BigIntRandom::operator ()() {
+	uint64_t result = _state[1] * 5;
+	result = ((result << 7) | (result >> 57)) * 9;
+
+	uint64_t t = _state[1] << 17;
+	_state[2] ^= _state[0];
+	_state[3] ^= _state[1];
+	_state[1] ^= _state[2];
+	_state[0] ^= _state[3];
+	_state[2] ^= t;
+	_state[3] = (_state[3] << 45) | (_state[3] >> 19);
+
+	return result;
+}
+
+void BigIntRandom::fill(ChunkBuffer& chunks, uint64_t bits) {
+	size_t size = std::max<size_t>(1, BigInt::checked_size(bits / 32 + (bits % 32 != 0 ? 1 : 0)));
+	chunks.resize(size);
+
+	size_t i = 0;
+	for (; i + 1 < size; i += 2) {
+		uint64_t value = (*this)();
+		chunks[i] = (uint32_t)value;
+		chunks[i + 1] = (uint32_t)(value >> 32);
+	}
+	if (i < size)
+		chunks[i] = (uint32_t)(*this)();
+
+	uint32_t top_bits = (uint32_t)(bits - 32 * (uint64_t)(size - 1));
+	if (bits == 0)
+		chunks[0] = 0;
+	else if (top_bits < 32)
+		chunks.back() &= (1u << top_bits) - 1;
+}
+
+BigInt BigIntRandom::bits(uint64_t bits) {
+	BigInt result;
+	fill(result._chunks, bits);
+	while (result._chunks.size() > 1 && result._chunks.back() == 0)
+		result._chunks.pop_back();
+	return result;
+}
+
+BigInt BigIntRandom::exact_bits(uint64_t bits) {
+	if (bits == 0)
+		throw std::invalid_argument("Number must have at least one bit");
+
+	BigInt result;
+	fill(result._chunks, bits);
+	result._chunks.back() |= 1u << ((bits - 1) % 32);
+	return result;
+}
+
+BigInt BigIntRandom::below(const BigInt& bound) {
+	if (bound <= 0)
+		throw std::invalid_argument("Bound must be positive");
+
+	uint64_t bit_count = (bound - 1).bit_length();
+	BigInt result;
+	do {
+		fill(result._chunks, bit_count);
+		while (result._chunks.size() > 1 && result._chunks.back() == 0)
+			result._chunks.pop_back();
+	} while (result >= bound);
+
+	return result;
+}
+
+BigInt BigIntRandom::range(const BigInt& low, const BigInt& high) {
+	if (high <= low)
+		throw std::invalid_argument("Range must not be empty");
+	return low + below(high - low);
+}
@@ -0,0 +1,440 @@
+﻿#include <bintrns.h>
+#include <cmath>
+#include <numeric>
+
+static bool is_word_prime(uint32_t number) {
+	if (number < 2)
+		return false;
+	for (uint32_t p : { 2u, 3u, 5u, 7u, 11u, 13u, 61u }) {
+		if (number % p == 0)
+			return number == p;
+	}
+
+	uint32_t odd_part = number - 1;
+	uint32_t two_power = 0;
+	while ((odd_part & 1) == 0) {
+		odd_part >>= 1;
+		two_power++;
+	}
+
+	for (uint64_t witness : { 2u, 7u, 61u }) {
+		uint64_t x = 1;
+		uint64_t power = witness;
+		for (uint32_t degree = odd_part; degree != 0; degree >>= 1) {
+			if (degree & 1)
+				x = x * power % number;
+			power = power * power % number;
+		}
+
+		if (x == 1 || x == number - 1)
+			continue;
+		bool composite = true;
+		for (uint32_t i = 1; i < two_power && composite; ++i) {
+			x = x * x % number;
+			composite = x != number - 1;
+		}
+		if (composite)
+			return false;
+	}
+
+	return true;
+}
+
+RnsBase::RnsBase(const std::vector<uint32_t>& moduli) : _moduli(moduli) {
+	if (moduli.empty())
+		throw std::invalid_argument("RNS base requires at least one module");
+
+	size_t size = moduli.size();
+	for (size_t i = 0; i < size; ++i) {
+		if (moduli[i] < 2)
+			throw std::invalid_argument("RNS moduli must be greater than one");
+		for (size_t j = 0; j < i; ++j)
+			if (std::gcd(moduli[i], moduli[j]) != 1)
+				throw std::invalid_argument("RNS moduli must be pairwise coprime");
+
+		uint32_t shift = BigInt::leading_zeros(moduli[i]);
+		_shifts.push_back(shift);
+		_reciprocals.push_back(BigInt::reciprocal_word(moduli[i] << shift));
+	}
+
+	_product = BigInt::product(std::vector<BigInt>(moduli.begin(), moduli.end()));
+	for (size_t i = 0; i < size; ++i) {
+		_cofactors.push_back(BigInt::divexact(_product, moduli[i]));
+		_cofactor_inverses.push_back(RnsBase::inverse((uint32_t)BigInt::mod_scalar(_cofactors[i], moduli[i]), moduli[i]));
+	}
+
+	_mixed_radix_inverses.resize(size);
+	for (size_t i = 0; i < size; ++i)
+		for (size_t j = 0; j < i; ++j)
+			_mixed_radix_inverses[i].push_back(RnsBase::inverse(moduli[j] % moduli[i], moduli[i]));
+}
+
+uint32_t RnsBase::inverse(uint32_t number, uint32_t module) {
+	int64_t old_r = number % module, r = module;
+	int64_t old_s = 1, s = 0;
+	while (r != 0) {
+		int64_t q = old_r / r;
+		old_r -= q * r;
+		std::swap(old_r, r);
+		old_s -= q * s;
+		std::swap(old_s, s);
+	}
+
+	if (old_r != 1)
+		throw std::invalid_argument("Number is not invertible by the module");
+
+	return (uint32_t)(old_s < 0 ? old_s + module : old_s);
+}
+
+std::vector<uint32_t> RnsBase::word_primes(size_t count, uint32_t below) {
+	std::vector<uint32_t> primes;
+	for (uint32_t candidate = below; primes.size() < count && candidate > 1; --candidate)
+		if (is_word_prime(candidate))
+			primes.push_back(candidate);
+
+	if (primes.size() < count)
+		throw std::invalid_argument("Not enough word primes below the bound");
+
+	return primes;
+}
+
+RnsBase RnsBase::generate(size_t count, uint32_t below) {
+	return RnsBase(RnsBase::word_primes(count, below));
+}
+
+size_t RnsBase::size() const {
+	return _moduli.size();
+}
+
+const std::vector<uint32_t>& RnsBase::moduli() const {
+	return _moduli;
+}
+
+const BigInt& RnsBase::product() const {
+	return _product;
+}
+
+const BigInt& RnsBase::cofactor(size_t channel) const {
+	return _cofactors.at(channel);
+}
+
+uint32_t RnsBase::cofactor_inverse(size_t channel) const {
+	return _cofactor_inverses.at(channel);
+}
+
+uint32_t RnsBase::add(uint32_t lhs, uint32_t rhs, size_t channel) const {
+	uint64_t sum = (uint64_t)lhs + rhs;
+	return (uint32_t)(sum >= _moduli[channel] ? sum - _moduli[channel] : sum);
+}
+
+uint32_t RnsBase::sub(uint32_t lhs, uint32_t rhs, size_t channel) const {
+	return lhs >= rhs ? lhs - rhs : lhs + (_moduli[channel] - rhs);
+}
+
+uint32_t RnsBase::mul(uint32_t lhs, uint32_t rhs, size_t channel) const {
+	uint32_t shift = _shifts[channel];
+	uint64_t product = ((uint64_t)lhs * rhs) << shift;
+	uint32_t remainder;
+	BigInt::div_2by1((uint32_t)(product >> 32), (uint32_t)product, _moduli[channel] << shift, _reciprocals[channel], remainder);
+	return remainder >> shift;
+}
+
+std::vector<uint32_t> RnsBase::add(const std::vector<uint32_t>& lhs, const std::vector<uint32_t>& rhs) const {
+	if (lhs.size() != _moduli.size() || rhs.size() != _moduli.size())
+		throw std::invalid_argument("Residue count does not match the RNS base");
+
+	std::vector<uint32_t> result(_moduli.size());
+	for (size_t i = 0; i < result.size(); ++i)
+		result[i] = add(lhs[i], rhs[i], i);
+	return result;
+}
+
+std::vector<uint32_t> RnsBase::sub(const std::vector<uint32_t>& lhs, const std::vector<uint32_t>& rhs) const {
+	if (lhs.size() != _moduli.size() || rhs.size() != _moduli.size())
+		throw std::invalid_argument("Residue count does not match the RNS base");
+
+	std::vector<uint32_t> result(_moduli.size());
+	for (size_t i = 0; i < result.size(); ++i)
+		result[i] = sub(lhs[i], rhs[i], i);
+	return result;
+}
+
+std::vector<uint32_t> RnsBase::mul(const std::vector<uint32_t>& lhs, const std::vector<uint32_t>& rhs) const {
+	if (lhs.size() != _moduli.size() || rhs.size() != _moduli.size())
+		throw std::invalid_argument("Residue count does not match the RNS base");
+
+	std::vector<uint32_t> result(_moduli.size());
+	for (size_t i = 0; i < result.size(); ++i)
+		result[i] = mul(lhs[i], rhs[i], i);
+	return result;
+}
+
+std::vector<uint32_t> RnsBase::to_residues(const BigInt& number) const {
+	std::vector<uint32_t> residues(_moduli.size());
+	for (size_t i = 0; i < residues.size(); ++i)
+		residues[i] = (uint32_t)BigInt::mod_scalar(number, _moduli[i]);
+	return residues;
+}
+
+BigInt RnsBase::from_residues(const std::vector<uint32_t>& residues) const {
+	if (residues.size() != _moduli.size())
+		throw std::invalid_argument("Residue count does not match the RNS base");
+
+	BigInt sum;
+	double fraction = 0;
+	for (size_t i = 0; i < residues.size(); ++i) {
+		uint32_t xi = mul(residues[i] % _moduli[i], _cofactor_inverses[i], i);
+		sum += BigInt::mul_scalar(_cofactors[i], xi);
+		fraction += (double)xi / _moduli[i];
+	}
+
+	BigInt result = sum - BigInt::mul_scalar(_product, (uint64_t)fraction);
+	while (result < 0)
+		result += _product;
+	while (result >= _product)
+		result -= _product;
+
+	return result;
+}
+
+std::vector<uint32_t> RnsBase::mixed_radix_digits(const std::vector<uint32_t>& residues) const {
+	if (residues.size() != _moduli.size())
+		throw std::invalid_argument("Residue count does not match the RNS base");
+
+	std::vector<uint32_t> digits(residues.size());
+	for (size_t i = 0; i < digits.size(); ++i) {
+		uint32_t digit = residues[i] % _moduli[i];
+		for (size_t j = 0; j < i; ++j)
+			digit = mul(sub(digit, digits[j] % _moduli[i], i), _mixed_radix_inverses[i][j], i);
+		digits[i] = digit;
+	}
+
+	return digits;
+}
+
+BigInt RnsBase::from_mixed_radix(const std::vector<uint32_t>& residues) const {
+	std::vector<uint32_t> digits = mixed_radix_digits(residues);
+
+	BigInt result = digits.back();
+	for (size_t i = digits.size() - 1; i-- > 0;)
+		result = BigInt::sum_scalar(BigInt::mul_scalar(result, _moduli[i]), digits[i]);
+
+	return result;
+}
+
+RnsInt::RnsInt(const std::shared_ptr<const RnsBase>& base, std::vector<uint32_t>&& residues) : _base(base), _residues(std::move(residues)) {}
+
+RnsInt::RnsInt(const std::shared_ptr<const RnsBase>& base, const BigInt& number) : _base(base), _residues(base->to_residues(number)) {}
+
+RnsInt RnsInt::from_residues(const std::shared_ptr<const RnsBase>& base, const std::vector<uint32_t>& residues) {
+	if (residues.size() != base->size())
+		throw std::invalid_argument("Residue count does not match the RNS base");
+	for (size_t i = 0; i < residues.size(); ++i)
+		if (residues[i] >= base->moduli()[i])
+			throw std::invalid_argument("Residue is not reduced by its module");
+
+	return RnsInt(base, std::vector<uint32_t>(residues));
+}
+
+void RnsInt::check_base(const RnsInt& other) const {
+	if (_base != other._base && _base->moduli() != other._base->moduli())
+		throw std::invalid_argument("Operands belong to different RNS bases");
+}
+
+const std::shared_ptr<const RnsBase>& RnsInt::base() const {
+	return _base;
+}
+
+const std::vector<uint32_t>& RnsInt::residues() const {
+	return _residues;
+}
+
+BigInt RnsInt::value() const {
+	return _base->from_residues(_residues);
+}
+
+BigInt RnsInt::signed_value() const {
+	BigInt result = value();
+	if (result * 2 > _base->product())
+		result -= _base->product();
+	return result;
+}
+
+RnsInt& RnsInt::operator +=(const RnsInt& other) {
+	check_base(other);
+	_residues = _base->add(_residues, other._residues);
+	return *this;
+}
+
+RnsInt& RnsInt::operator -=(const RnsInt& other) {
+	check_base(other);
+	_residues = _base->sub(_residues, other._residues);
+	return *this;
+}
+
+RnsInt& RnsInt::operator *=(const RnsInt& other) {
+	check_base(other);
+	_residues = _base->mul(_residues, other._residues);
+	return *this;
+}
+
+RnsInt RnsInt::operator +(const RnsInt& other) const {
+	check_base(other);
+	return RnsInt(_base, _base->add(_residues, other._residues));
+}
+
+RnsInt RnsInt::operator -(const RnsInt& other) const {
+	check_base(other);
+	return RnsInt(_base, _base->sub(_residues, other._residues));
+}
+
+RnsInt RnsInt::operator -() const {
+	return RnsInt(_base, _base->sub(std::vector<uint32_t>(_residues.size(), 0), _residues));
+}
+
+RnsInt RnsInt::operator *(const RnsInt& other) const {
+	check_base(other);
+	return RnsInt(_base, _base->mul(_residues, other._residues));
+}
+
+bool RnsInt::operator ==(const RnsInt& other) const {
+	return _base->moduli() == other._base->moduli() && _residues == other._residues;
+}
+
+bool RnsInt::operator !=(const RnsInt& other) const {
+	return !(*this == other);
+}
+
+std::ostream& operator <<(std::ostream& os, const RnsInt& number) {
+	return os << number.value();
+}
+
+static size_t montgomery_base_size(const BigInt& module) {
+	size_t size = 1;
+	while (31 * size < module.bit_length() + 2 * BigInt(uint32_t(size + 2)).bit_length() + 2)
+		size++;
+	return size;
+}
+
+RnsMontgomeryContext::RnsMontgomeryContext(const BigInt& module) : RnsMontgomeryContext(module, RnsBase::word_primes(2 * montgomery_base_size(module) + 1)) {}
+
+RnsMontgomeryContext::RnsMontgomeryContext(const BigInt& module, const std::vector<uint32_t>& primes) :
+	_module(module),
+	_base(std::vector<uint32_t>(primes.begin(), primes.begin() + primes.size() / 2)),
+	_extension(std::vector<uint32_t>(primes.begin() + primes.size() / 2, primes.end())) {
+	if (module <= 1)
+		throw std::invalid_argument("Module must be greater than one");
+
+	const std::vector<uint32_t>& base_moduli = _base.moduli();
+	const std::vector<uint32_t>& extension_moduli = _extension.moduli();
+
+	for (size_t i = 0; i < base_moduli.size(); ++i) {
+		uint32_t module_residue = (uint32_t)BigInt::mod_scalar(module, base_moduli[i]);
+		if (module_residue == 0)
+			throw std::invalid_argument("Module must be coprime with the RNS base");
+
+		uint32_t negated_inverse = base_moduli[i] - RnsBase::inverse(module_residue, base_moduli[i]);
+		_quotient_factors.push_back(_base.mul(negated_inverse, _base.cofactor_inverse(i), i));
+		_extension_product_residues.push_back((uint32_t)BigInt::mod_scalar(_extension.product(), base_moduli[i]));
+		_extension_to_base.emplace_back();
+		for (size_t j = 0; j < extension_moduli.size(); ++j)
+			_extension_to_base[i].push_back((uint32_t)BigInt::mod_scalar(_extension.cofactor(j), base_moduli[i]));
+	}
+
+	for (size_t j = 0; j < extension_moduli.size(); ++j) {
+		_module_residues.push_back((uint32_t)BigInt::mod_scalar(module, extension_moduli[j]));
+		_base_inverses.push_back(RnsBase::inverse((uint32_t)BigInt::mod_scalar(_base.product(), extension_moduli[j]), extension_moduli[j]));
+		_base_to_extension.emplace_back();
+		for (size_t i = 0; i < base_moduli.size(); ++i)
+			_base_to_extension[j].push_back((uint32_t)BigInt::mod_scalar(_base.cofactor(i), extension_moduli[j]));
+	}
+
+	_one = to_montgomery(1);
+}
+
+const BigInt& RnsMontgomeryContext::module() const {
+	return _module;
+}
+
+const RnsBase& RnsMontgomeryContext::base() const {
+	return _base;
+}
+
+const RnsBase& RnsMontgomeryContext::extension() const {
+	return _extension;
+}
+
+const std::vector<uint32_t>& RnsMontgomeryContext::one() const {
+	return _one;
+}
+
+std::vector<uint32_t> RnsMontgomeryContext::to_montgomery(const BigInt& number) const {
+	BigInt value = BigInt::mod(BigInt::mod(number, _module) * _base.product(), _module);
+
+	std::vector<uint32_t> residues = _base.to_residues(value);
+	std::vector<uint32_t> extension = _extension.to_residues(value);
+	residues.insert(residues.end(), extension.begin(), extension.end());
+	return residues;
+}
+
+BigInt RnsMontgomeryContext::from_montgomery(const std::vector<uint32_t>& residues) const {
+	std::vector<uint32_t> reduced = mul(residues, std::vector<uint32_t>(residues.size(), 1));
+	return BigInt::mod(_extension.from_residues(std::vector<uint32_t>(reduced.begin() + _base.size(), reduced.end())), _module);
+}
+
+std::vector<uint32_t> RnsMontgomeryContext::mul(const std::vector<uint32_t>& lhs, const std::vector<uint32_t>& rhs) const {
+	size_t base_size = _base.size();
+	size_t extension_size = _extension.size();
+	if (lhs.size() != base_size + extension_size || rhs.size() != base_size + extension_size)
+		throw std::invalid_argument("Residue count does not match the RNS bases");
+
+	std::vector<uint32_t> result(base_size + extension_size);
+
+	std::vector<uint32_t> quotient(base_size);
+	for (size_t i = 0; i < base_size; ++i)
+		quotient[i] = _base.mul(_base.mul(lhs[i], rhs[i], i), _quotient_factors[i], i);
+
+	const std::vector<uint32_t>& extension_moduli = _extension.moduli();
+	std::vector<uint32_t> remainder(extension_size);
+	double fraction = 0;
+	for (size_t j = 0; j < extension_size; ++j) {
+		uint32_t extended = 0;
+		for (size_t i = 0; i < base_size; ++i)
+			extended = _extension.add(extended, _extension.mul(quotient[i], _base_to_extension[j][i], j), j);
+
+		uint32_t product = _extension.mul(lhs[base_size + j], rhs[base_size + j], j);
+		product = _extension.add(product, _extension.mul(extended, _module_residues[j], j), j);
+		result[base_size + j] = _extension.mul(product, _base_inverses[j], j);
+
+		remainder[j] = _extension.mul(result[base_size + j], _extension.cofactor_inverse(j), j);
+		fraction += (double)remainder[j] / extension_moduli[j];
+	}
+
+	uint32_t overflow = (uint32_t)std::llround(fraction);
+	for (size_t i = 0; i < base_size; ++i) {
+		uint32_t value = 0;
+		for (size_t j = 0; j < extension_size; ++j)
+			value = _base.add(value, _base.mul(remainder[j], _extension_to_base[i][j], i), i);
+		result[i] = _base.sub(value, _base.mul(overflow, _extension_product_residues[i], i), i);
+	}
+
+	return result;
+}
+
+std::vector<uint32_t> RnsMontgomeryContext::pow(const std::vector<uint32_t>& number, const BigInt& degree) const {
+	if (degree < 0)
+		throw std::invalid_argument("Degree must be non-negative");
+
+	std::vector<uint32_t> result = _one;
+	for (uint64_t bit = degree.bit_length(); bit-- > 0;) {
+		result = mul(result, result);
+		if (degree.test_bit(bit))
+			result = mul(result, number);
+	}
+
+	return result;
+}
+
+BigInt RnsMontgomeryContext::pow(const BigInt& number, const BigInt& degree) const {
+	return from_montgomery(pow(to_montgomery(number), degree));
+}
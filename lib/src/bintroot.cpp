@@ -0,0 +1,152 @@
+﻿#include <bintlib.h>
+#include <cmath>
+
+static uint64_t pow_mod_word(uint64_t number, uint64_t degree, uint64_t module) {
+	uint64_t result = 1;
+	number %= module;
+	while (degree > 0) {
+		if (degree & 1)
+			result = result * number % module;
+		number = number * number % module;
+		degree >>= 1;
+	}
+	return result;
+}
+
+static bool is_word_prime(uint64_t number) {
+	if (number < 2)
+		return false;
+	for (uint64_t divider = 2; divider * divider <= number; divider++) {
+		if (number % divider == 0)
+			return false;
+	}
+	return true;
+}
+
+static bool is_power_residue(const BigInt& number, uint32_t degree) {
+	size_t checked = 0;
+	for (uint64_t module = 2 * (uint64_t)degree + 1; checked < 4 && module <= UINT32_MAX; module += 2 * (uint64_t)degree) {
+		if (!is_word_prime(module))
+			continue;
+		checked++;
+
+		uint64_t residue = BigInt::mod_scalar(number, module);
+		if (residue != 0 && pow_mod_word(residue, (module - 1) / degree, module) != 1)
+			return false;
+	}
+	return true;
+}
+
+static BigInt root_floor(const BigInt& number, uint32_t degree) {
+	uint64_t bits = number.bit_length();
+	uint64_t root_bits = (bits + degree - 1) / degree;
+
+	if (root_bits <= 32) {
+		uint64_t shift = bits > 53 ? bits - 53 : 0;
+		double log2 = std::log2((number >> shift).to_double()) + (double)shift;
+		BigInt root = BigInt::from_scalar((uint64_t)std::exp2(log2 / degree) + 1);
+		while (BigInt::binary_pow(root, degree) > number)
+			root -= 1;
+		while (BigInt::binary_pow(root + 1, degree) <= number)
+			root += 1;
+		return root;
+	}
+
+	uint64_t half = root_bits / 2;
+	BigInt root = (root_floor(number >> (degree * half), degree) + 1) << half;
+	while (true) {
+		BigInt next = (root * (degree - 1) + number / BigInt::binary_pow(root, degree - 1)) / degree;
+		if (next >= root)
+			break;
+		root = next;
+	}
+
+	return root;
+}
+
+std::pair<BigInt, BigInt> BigInt::sqrt_rem(const BigInt& number) {
+	if (number < 0)
+		throw std::invalid_argument("Square root of a negative number");
+	if (number < 2)
+		return { BigInt::abs(number), BigInt() };
+
+	uint64_t c = (number.bit_length() - 1) / 2;
+	uint32_t steps = 0;
+	while ((c >> steps) != 0)
+		steps++;
+
+	BigInt root = 1;
+	uint64_t d = 0;
+	for (uint32_t s = steps; s-- > 0;) {
+		uint64_t e = d;
+		d = c >> s;
+		root = (root << (d - e - 1)) + (number >> (2 * c - e - d + 1)) / root;
+	}
+
+	BigInt remainder = number - root * root;
+	if (remainder < 0) {
+		root -= 1;
+		remainder += (root << 1) + 1;
+	}
+
+	return { root, remainder };
+}
+
+BigInt BigInt::isqrt(const BigInt& number) {
+	return BigInt::sqrt_rem(number).first;
+}
+
+std::pair<BigInt, BigInt> BigInt::root_rem(const BigInt& number, uint32_t degree) {
+	if (degree == 0)
+		throw std::invalid_argument("Root of zero degree");
+	if (number < 0 && degree % 2 == 0)
+		throw std::invalid_argument("Even root of a negative number");
+	if (degree == 1)
+		return { number, BigInt() };
+	if (degree == 2)
+		return BigInt::sqrt_rem(number);
+
+	BigInt magnitude = BigInt::abs(number);
+	if (magnitude < 2)
+		return { number, BigInt() };
+
+	BigInt root = root_floor(magnitude, degree);
+	BigInt remainder = magnitude - BigInt::binary_pow(root, degree);
+	if (number < 0)
+		return { -root, remainder == 0 ? remainder : -remainder };
+
+	return { root, remainder };
+}
+
+BigInt BigInt::iroot(const BigInt& number, uint32_t degree) {
+	return BigInt::root_rem(number, degree).first;
+}
+
+bool BigInt::is_perfect_power(const BigInt& number) {
+	BigInt magnitude = BigInt::abs(number);
+	if (magnitude < 2)
+		return true;
+
+	uint64_t bits = magnitude.bit_length();
+	uint64_t twos = magnitude.count_trailing_zeros();
+	uint64_t max_degree = std::min<uint64_t>(bits, UINT32_MAX);
+	std::vector<bool> composite(max_degree + 1, false);
+
+	for (uint64_t p = 2; p <= max_degree; p++) {
+		if (composite[p])
+			continue;
+		for (uint64_t multiple = p * p; multiple <= max_degree; multiple += p)
+			composite[multiple] = true;
+
+		if (number < 0 && p == 2)
+			continue;
+		if (twos > 0 && twos % p != 0)
+			continue;
+		if (!is_power_residue(magnitude, (uint32_t)p))
+			continue;
+		if (BigInt::root_rem(magnitude, (uint32_t)p).second == 0)
+			return true;
+	}
+
+	return false;
+}
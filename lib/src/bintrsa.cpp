@@ -0,0 +1,45 @@
+﻿#include <bintrsa.h>
+#include <future>
+
+RsaCrtContext::RsaCrtContext(const BigInt& p, const BigInt& q, const BigInt& exponent, bool parallel) : _p(p), _q(q), _module(p * q), _p_context(p), _q_context(q), _parallel(parallel) {
+	if (p == q)
+		throw std::invalid_argument("Factors must be distinct");
+	if (exponent <= 0)
+		throw std::invalid_argument("Exponent must be positive");
+
+	_dp = exponent % (p - 1);
+	_dq = exponent % (q - 1);
+	_q_inv = _p_context.to_montgomery(BigInt::mod_inverse(q % p, p));
+}
+
+const BigInt& RsaCrtContext::module() const {
+	return _module;
+}
+
+bool RsaCrtContext::parallel() const {
+	return _parallel;
+}
+
+void RsaCrtContext::set_parallel(bool parallel) {
+	_parallel = parallel;
+}
+
+BigInt RsaCrtContext::pow(const BigInt& number) const {
+	auto half_pow = [&number](const MontgomeryContext& context, const BigInt& degree) {
+		return context.from_montgomery(context.pow(context.to_montgomery(number), degree));
+	};
+
+	BigInt m1, m2;
+	if (_parallel) {
+		auto future = std::async(std::launch::async, half_pow, std::cref(_q_context), std::cref(_dq));
+		m1 = half_pow(_p_context, _dp);
+		m2 = future.get();
+	}
+	else {
+		m1 = half_pow(_p_context, _dp);
+		m2 = half_pow(_q_context, _dq);
+	}
+
+	BigInt h = _p_context.mul(BigInt::mod(m1 - m2, _p), _q_inv);
+	return m2 + h * _q;
+}
@@ -0,0 +1,131 @@
+﻿#include <binttree.h>
+#include <functional>
+#include <future>
+
+static void parallel_for(size_t count, size_t threads, const std::function<void(size_t)>& body) {
+	threads = std::min(std::max<size_t>(threads, 1), count);
+	if (threads <= 1) {
+		for (size_t i = 0; i < count; ++i)
+			body(i);
+		return;
+	}
+
+	std::vector<std::future<void>> workers;
+	for (size_t t = 0; t < threads; ++t) {
+		workers.push_back(std::async(std::launch::async, [&body, count, threads, t]() {
+			for (size_t i = t; i < count; i += threads)
+				body(i);
+		}));
+	}
+	for (auto& worker : workers)
+		worker.get();
+}
+
+ProductTree::ProductTree(const std::vector<BigInt>& numbers, size_t threads) : _threads(std::max<size_t>(threads, 1)) {
+	if (numbers.empty())
+		throw std::invalid_argument("Product tree requires at least one number");
+
+	_levels.push_back(numbers);
+	while (_levels.back().size() > 1) {
+		const std::vector<BigInt>& current = _levels.back();
+		std::vector<BigInt> next((current.size() + 1) / 2);
+
+		parallel_for(next.size(), _threads, [&](size_t i) {
+			next[i] = 2 * i + 1 < current.size() ? current[2 * i] * current[2 * i + 1] : current[2 * i];
+		});
+
+		_levels.push_back(std::move(next));
+	}
+}
+
+size_t ProductTree::size() const {
+	return _levels.front().size();
+}
+
+size_t ProductTree::depth() const {
+	return _levels.size();
+}
+
+const BigInt& ProductTree::root() const {
+	return _levels.back().front();
+}
+
+const std::vector<BigInt>& ProductTree::level(size_t index) const {
+	return _levels.at(index);
+}
+
+std::vector<BigInt> ProductTree::descend(const BigInt& number, bool squared) const {
+	auto module = [squared](const BigInt& node) {
+		return squared ? BigInt::karatsuba_square(node) : node;
+	};
+
+	std::vector<BigInt> current = { number % module(root()) };
+	for (size_t depth = _levels.size() - 1; depth-- > 0;) {
+		const std::vector<BigInt>& nodes = _levels[depth];
+		std::vector<BigInt> next(nodes.size());
+
+		parallel_for(nodes.size(), _threads, [&](size_t i) {
+			next[i] = current[i / 2] % module(nodes[i]);
+		});
+
+		current = std::move(next);
+	}
+
+	return current;
+}
+
+std::vector<BigInt> ProductTree::remainders(const BigInt& number) const {
+	return descend(number, false);
+}
+
+std::vector<BigInt> ProductTree::remainders(const BigInt& number, const std::vector<BigInt>& moduli, size_t threads) {
+	return ProductTree(moduli, threads).remainders(number);
+}
+
+std::vector<BigInt> ProductTree::batch_gcd(const std::vector<BigInt>& moduli, size_t threads, size_t batch_size) {
+	if (moduli.empty())
+		return {};
+	if (batch_size == 0 || batch_size > moduli.size())
+		batch_size = moduli.size();
+
+	size_t batch_count = (moduli.size() + batch_size - 1) / batch_size;
+	auto batch = [&](size_t index) {
+		auto first = moduli.begin() + index * batch_size;
+		return std::vector<BigInt>(first, first + std::min(batch_size, moduli.size() - index * batch_size));
+	};
+
+	std::vector<BigInt> roots;
+	if (batch_count > 1)
+		for (size_t j = 0; j < batch_count; ++j)
+			roots.push_back(BigInt::product(batch(j), threads));
+
+	std::vector<BigInt> result;
+	result.reserve(moduli.size());
+
+	for (size_t i = 0; i < batch_count; ++i) {
+		ProductTree tree(batch(i), threads);
+		const std::vector<BigInt>& leaves = tree.level(0);
+		std::vector<BigInt> cofactors = tree.descend(tree.root(), true);
+
+		parallel_for(leaves.size(), threads, [&](size_t k) {
+			cofactors[k] = BigInt::divexact(cofactors[k], leaves[k]);
+		});
+
+		for (size_t j = 0; j < batch_count; ++j) {
+			if (j == i)
+				continue;
+			std::vector<BigInt> other = tree.remainders(roots[j]);
+			parallel_for(leaves.size(), threads, [&](size_t k) {
+				cofactors[k] = cofactors[k] * other[k] % leaves[k];
+			});
+		}
+
+		std::vector<BigInt> gcds(leaves.size());
+		parallel_for(leaves.size(), threads, [&](size_t k) {
+			gcds[k] = BigInt::gcd(leaves[k], cofactors[k]);
+		});
+		result.insert(result.end(), gcds.begin(), gcds.end());
+	}
+
+	return result;
+}
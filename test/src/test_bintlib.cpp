@@ -1,5 +1,18 @@
 #include "bintlib.h"
+#include "bintaccum.h"
+#include "bintbatch.h"
+#include "bintdisk.h"
+#include "bintfixed.h"
+#include "bintliteral.h"
+#include "bintmod.h"
+#include "bintprime.h"
+#include "bintrandom.h"
+#include "bintrns.h"
+#include "bintrsa.h"
+#include "binttree.h"
 #include <catch2/catch_test_macros.hpp>
+#include <future>
+#include <filesystem>
 
 namespace test_bintlib
 {
@@ -18,6 +31,30 @@ namespace test_bintlib
         }
     }
 
+    TEST_CASE("BigInt Literal", "[literal]") {
+        SECTION("Check 1: decimal _bi") {
+            BigInt number = 12345678901234567890_bi;
+            REQUIRE(number == BigInt("12345678901234567890"));
+            REQUIRE((-455675676762455675676762_bi).to_string() == "-455675676762455675676762");
+            REQUIRE(0_bi == BigInt());
+        }
+
+        SECTION("Check 2: hex _bi") {
+            BigInt number = 0xAB54A98CEB1F0AD2_bi;
+            REQUIRE(number == BigInt("12345678901234567890"));
+            REQUIRE(0x1'0000'0000'0000'0000_bi == BigInt(1) << 64);
+        }
+
+        SECTION("Check 3: constexpr _fbi") {
+            constexpr auto number = 12345678901234567890_fbi;
+            static_assert(number.chunk(0) == 3944680146u);
+            static_assert(number.chunk(1) == 2874452364u);
+            static_assert(sizeof(number) == 2 * sizeof(uint32_t));
+            FixedBigUInt<128> wide = number;
+            REQUIRE(wide.to_bigint().to_string() == "12345678901234567890");
+        }
+    }
+
     TEST_CASE("BigInt Concatenation", "[concatenation]") {
         SECTION("Check 1: concat_number") {
             auto chunks = BigInt::parse_number("12345678901234567890");
@@ -62,6 +99,99 @@ namespace test_bintlib
         }
     }
 
+    TEST_CASE("BigInt Shared Chunks", "[shared_chunks]") {
+        BigInt number1 = BigInt("4556756767624525666272634167235675676762");
+        BigInt number2 = BigInt("-12345678901234567890");
+
+        SECTION("Check 1: copies") {
+            BigInt copy = number1;
+            BigInt negated = -number1;
+            BigInt absolute = BigInt::abs(negated);
+#ifdef BINTLIB_COW
+            REQUIRE(copy.shares_chunks(number1));
+            REQUIRE(negated.shares_chunks(number1));
+            REQUIRE(absolute.shares_chunks(number1));
+#endif
+            copy += number2;
+            REQUIRE(!copy.shares_chunks(number1));
+            REQUIRE(number1.to_string() == "4556756767624525666272634167235675676762");
+            REQUIRE(negated.to_string() == "-4556756767624525666272634167235675676762");
+            REQUIRE(absolute == number1);
+            REQUIRE(number1 - negated == number1 * 2);
+        }
+
+        SECTION("Check 2: division") {
+            BigInt dividend = number1;
+            auto result = BigInt::div(dividend, number2);
+            REQUIRE(dividend == number1);
+            REQUIRE(result.first * number2 + result.second == number1);
+        }
+
+        SECTION("Check 3: threads") {
+            const BigInt module = (BigInt(1) << 127) - 1;
+            std::vector<std::future<BigInt>> workers;
+            for (uint32_t i = 0; i < 4; ++i)
+                workers.push_back(std::async(std::launch::async, [&module, &number1, i]() {
+                    BigInt local = module;
+                    return BigInt::montgomery_pow(number1 + i, module - 1, local, 16);
+                }));
+            for (auto& worker : workers)
+                REQUIRE(worker.get() == 1);
+            REQUIRE(module == (BigInt(1) << 127) - 1);
+        }
+
+        SECTION("Check 4: moves") {
+            static_assert(std::is_nothrow_move_constructible_v<BigInt>);
+            BigInt copy = number2;
+            BigInt moved(std::move(copy));
+            REQUIRE(moved == number2);
+            copy = std::move(moved);
+            REQUIRE(copy.to_string() == "-12345678901234567890");
+        }
+    }
+
+    TEST_CASE("BigInt Accumulator", "[accumulator]") {
+        BigInt number1 = BigInt("4556756767624525666272634167235675676762");
+        BigInt number2 = BigInt("-12345678901234567890");
+        BigInt number3 = (BigInt(1) << 2000) - 1;
+
+        SECTION("Check 1: add and sub") {
+            BigIntAccumulator accumulator;
+            accumulator += number1;
+            accumulator -= number2;
+            accumulator += number2;
+            accumulator.sub(number1).add(number3);
+            accumulator += -5;
+            accumulator -= UINT64_MAX;
+            REQUIRE(accumulator.result() == number3 - 5 - BigInt::from_scalar(UINT64_MAX));
+            accumulator.clear();
+            REQUIRE(accumulator.result() == 0);
+        }
+
+        SECTION("Check 2: addmul") {
+            BigIntAccumulator accumulator;
+            BigInt expected = 0;
+            for (uint32_t i = 0; i < 100; ++i) {
+                BigInt factor = number3 >> (i * 17);
+                accumulator.addmul(number1, factor);
+                accumulator.submul(number2, number3 - factor);
+                expected += number1 * factor - number2 * (number3 - factor);
+            }
+            accumulator.addmul(number3, number3);
+            expected += number3 * number3;
+            REQUIRE(accumulator.result() == expected);
+        }
+
+        SECTION("Check 3: carries") {
+            BigIntAccumulator accumulator;
+            for (uint32_t i = 0; i < 10000; ++i)
+                accumulator += number3;
+            REQUIRE(accumulator.result() == number3 * 10000);
+            accumulator -= number3 * 10001;
+            REQUIRE(accumulator.result() == -number3);
+        }
+    }
+
     TEST_CASE("BigInt Multiplication", "[multiplication]") {
         BigInt number1 = BigInt("-12345678901234567890");
         BigInt number2 = BigInt("455675676762455675676762");
@@ -94,6 +224,100 @@ namespace test_bintlib
         }
     }
 
+    TEST_CASE("BigInt Unbalanced Multiplication", "[unbalanced_multiplication]") {
+        BigIntRandom random(42);
+        BigInt number1 = random.exact_bits(32 * 1200);
+        BigInt number2 = -random.exact_bits(32 * 500);
+        BigInt number3 = (BigInt(1) << (32 * 700)) - 1;
+
+        SECTION("Check 1: toom32_mul") {
+            REQUIRE(BigInt::toom32_mul(number1, number2) == BigInt::simple_mul(number1, number2));
+            REQUIRE(BigInt::toom32_mul(number2, number3) == BigInt::simple_mul(number2, number3));
+        }
+
+        SECTION("Check 2: toom42_mul") {
+            REQUIRE(BigInt::toom42_mul(number1, number2) == BigInt::simple_mul(number1, number2));
+            REQUIRE(BigInt::toom42_mul(number3, -number2) == BigInt::simple_mul(number3, -number2));
+        }
+
+        SECTION("Check 3: unbalanced_mul") {
+            BigInt number4 = random.exact_bits(32 * 5000 + 7);
+            REQUIRE(BigInt::unbalanced_mul(number4, number2) == BigInt::simple_mul(number4, number2));
+            REQUIRE(number2 * number4 == BigInt::simple_mul(number4, number2));
+            REQUIRE(number3 * number1 == BigInt::simple_mul(number3, number1));
+            REQUIRE(BigInt::unbalanced_mul(number4, 0) == 0);
+        }
+    }
+
+    TEST_CASE("Disk BigInt", "[disk]") {
+        BigIntRandom random(7);
+        BigInt number1 = random.exact_bits(32 * 3000);
+        BigInt number2 = -random.exact_bits(32 * 1100 + 5);
+        std::filesystem::path directory = std::filesystem::temp_directory_path();
+        std::string path1 = (directory / "bint_disk_lhs.bin").string();
+        std::string path2 = (directory / "bint_disk_rhs.bin").string();
+        std::string path3 = (directory / "bint_disk_result.bin").string();
+
+        SECTION("Check 1: store and load") {
+            DiskBigInt disk = DiskBigInt::store(number2, path1);
+            REQUIRE(disk.size() == 1101);
+            REQUIRE(disk.is_negative());
+            REQUIRE(disk.load() == number2);
+            REQUIRE(disk.block(1100, 10) == BigInt::abs(number2) >> (32 * 1100));
+            REQUIRE(DiskBigInt(path1).is_negative());
+            REQUIRE(DiskBigInt(path1).load() == number2);
+        }
+
+        SECTION("Check 2: mul") {
+            DiskBigInt lhs = DiskBigInt::store(number1, path1);
+            DiskBigInt rhs = DiskBigInt::store(number2, path2);
+            REQUIRE(DiskBigInt::mul(lhs, rhs, path3, 64 * 256).load() == number1 * number2);
+            REQUIRE(DiskBigInt::mul(rhs, rhs, path3, 64 * 100).load() == number2 * number2);
+            REQUIRE(DiskBigInt::mul(lhs, rhs, path3).load() == number1 * number2);
+            REQUIRE(DiskBigInt::mul(lhs, DiskBigInt::store(0, path2), path3).load() == 0);
+            REQUIRE(DiskBigInt(path3).size() == 1);
+        }
+
+        SECTION("Check 3: result aliases an operand") {
+            DiskBigInt lhs = DiskBigInt::store(number1, path1);
+            DiskBigInt rhs = DiskBigInt::store(number2, path2);
+            REQUIRE_THROWS_AS(DiskBigInt::mul(lhs, rhs, path1), std::invalid_argument);
+            REQUIRE_THROWS_AS(DiskBigInt::mul(lhs, rhs, path2), std::invalid_argument);
+            REQUIRE(DiskBigInt(path1).load() == number1);
+            REQUIRE(DiskBigInt(path2).load() == number2);
+        }
+
+        SECTION("Check 4: missing file") {
+            REQUIRE_THROWS_AS(DiskBigInt((directory / "bint_disk_missing.bin").string()), std::invalid_argument);
+        }
+
+        SECTION("Check 5: unbalanced all-ones operands") {
+            for (auto [lhs_count, rhs_count] : { std::pair<uint64_t, uint64_t>{ 65, 34 }, { 97, 50 }, { 129, 34 } }) {
+                BigInt number3 = (BigInt(1) << (32 * lhs_count)) - 1;
+                BigInt number4 = (BigInt(1) << (32 * rhs_count)) - 1;
+                DiskBigInt lhs = DiskBigInt::store(number3, path1);
+                DiskBigInt rhs = DiskBigInt::store(number4, path2);
+                REQUIRE(DiskBigInt::mul(lhs, rhs, path3, 2048).load() == number3 * number4);
+            }
+            REQUIRE_FALSE(std::filesystem::exists(path3 + ".0"));
+            REQUIRE_FALSE(std::filesystem::exists(path3 + ".1"));
+            REQUIRE_FALSE(std::filesystem::exists(path3 + ".2"));
+        }
+
+        SECTION("Check 6: operand at a scratch name") {
+            std::string path4 = path3 + ".0";
+            DiskBigInt lhs = DiskBigInt::store(number1, path4);
+            DiskBigInt rhs = DiskBigInt::store(number2, path2);
+            REQUIRE(DiskBigInt::mul(lhs, rhs, path3, 64 * 256).load() == number1 * number2);
+            REQUIRE(DiskBigInt(path4).load() == number1);
+            std::filesystem::remove(path4);
+        }
+
+        std::filesystem::remove(path1);
+        std::filesystem::remove(path2);
+        std::filesystem::remove(path3);
+    }
+
     TEST_CASE("BigInt Karatsuba Square", "[karatsuba_square]") {
         BigInt number1 = BigInt("12312312312312321");
         BigInt number2 = BigInt("-455675676762455675676762");
@@ -109,6 +333,116 @@ namespace test_bintlib
         }
     }
 
+    TEST_CASE("BigInt Basecase Square", "[sqr_basecase]") {
+        BigInt number1 = BigInt("12312312312312321");
+        BigInt number2 = BigInt("-455675676762455675676762");
+        BigInt number3 = BigInt::binary_pow(BigInt("4294967295"), BigInt("100"));
+
+        SECTION("Check 1: sqr_basecase") {
+            std::string result = BigInt::sqr_basecase(number1).to_string();
+            REQUIRE(result == "151593034475917572731289848407041");
+        }
+
+        SECTION("Check 2: sqr_basecase") {
+            std::string result = BigInt::sqr_basecase(number2).to_string();
+            REQUIRE(result == "207640322392921987449429221053931680506706804644");
+        }
+
+        SECTION("Check 3: sqr_basecase") {
+            REQUIRE(BigInt::sqr_basecase(number3) == BigInt::simple_mul(number3, number3));
+            REQUIRE(BigInt::karatsuba_square(number3) == BigInt::simple_mul(number3, number3));
+            REQUIRE(number3 * number3 == BigInt::simple_mul(number3, number3));
+        }
+    }
+
+    TEST_CASE("BigInt Product", "[product]") {
+        SECTION("Check 1: product") {
+            std::vector<BigInt> numbers;
+            BigInt expected = 1;
+            for (uint32_t i = 0; i < 300; ++i) {
+                numbers.push_back(BigInt("4556756767624525666272634167235675676762") + i);
+                expected *= numbers.back();
+            }
+            REQUIRE(BigInt::product(numbers) == expected);
+            REQUIRE(BigInt::product(numbers, 4) == expected);
+            REQUIRE(BigInt::product({}) == 1);
+        }
+
+        SECTION("Check 2: factorial") {
+            REQUIRE(BigInt::factorial(0) == 1);
+            REQUIRE(BigInt::factorial(20).to_string() == "2432902008176640000");
+            REQUIRE(BigInt::factorial(25).to_string() == "15511210043330985984000000");
+            REQUIRE(BigInt::factorial(100).to_string() == "93326215443944152681699238856266700490715968264381621468592963895217599993229915608941463976156518286253697920827223758251185210916864000000000000000000000000");
+            REQUIRE(BigInt::factorial(1000, 4) == BigInt::factorial(999) * 1000);
+        }
+
+        SECTION("Check 3: binomial") {
+            REQUIRE(BigInt::binomial(100, 33).to_string() == "294692427022540894366527900");
+            REQUIRE(BigInt::binomial(5, 7) == 0);
+            REQUIRE(BigInt::binomial(5, 0) == 1);
+            REQUIRE(BigInt::binomial(400, 200) * BigInt::factorial(200) * BigInt::factorial(200) == BigInt::factorial(400));
+            REQUIRE(BigInt::binomial(4294967295u, 2).to_string() == "9223372030412324865");
+            REQUIRE(BigInt::binomial(1000000000, 3).to_string() == "166666666166666667000000000");
+            REQUIRE(BigInt::binomial(100000, 40) * BigInt::factorial(40) == BigInt::factorial(100000) / BigInt::factorial(99960));
+        }
+
+        SECTION("Check 4: primorial") {
+            REQUIRE(BigInt::primorial(1) == 1);
+            REQUIRE(BigInt::primorial(10) == 210);
+            REQUIRE(BigInt::primorial(100).to_string() == "2305567963945518424753102147331756070");
+        }
+    }
+
+    TEST_CASE("Product Tree", "[product_tree]") {
+        SECTION("Check 1: tree") {
+            ProductTree tree({ BigInt(3), BigInt(5), BigInt(7), BigInt(11), BigInt(13) });
+            REQUIRE(tree.size() == 5);
+            REQUIRE(tree.depth() == 4);
+            REQUIRE(tree.root() == 15015);
+            REQUIRE(tree.level(1).size() == 3);
+            REQUIRE(tree.level(1)[2] == 13);
+        }
+
+        SECTION("Check 2: remainders") {
+            BigIntRandom random(39);
+            std::vector<BigInt> moduli;
+            for (uint32_t i = 0; i < 37; ++i)
+                moduli.push_back(random.exact_bits(300 + 17 * i));
+            BigInt number = random.bits(20000);
+            std::vector<BigInt> remainders = ProductTree::remainders(number, moduli, 2);
+            REQUIRE(remainders.size() == moduli.size());
+            for (size_t i = 0; i < moduli.size(); ++i)
+                REQUIRE(remainders[i] == number % moduli[i]);
+        }
+
+        SECTION("Check 3: batch gcd") {
+            std::vector<BigInt> moduli = { BigInt(15), BigInt(35), BigInt(143), BigInt(17 * 19), BigInt(19 * 23) };
+            std::vector<BigInt> expected = { BigInt(5), BigInt(5), BigInt(1), BigInt(19), BigInt(19) };
+            REQUIRE(ProductTree::batch_gcd(moduli) == expected);
+            REQUIRE(ProductTree::batch_gcd(moduli, 2, 2) == expected);
+        }
+
+        SECTION("Check 4: batch gcd") {
+            BigIntRandom random(2039);
+            std::vector<BigInt> primes;
+            for (uint32_t i = 0; i < 41; ++i)
+                primes.push_back(Primality::random_prime(64, 100 + i));
+            std::vector<BigInt> moduli;
+            for (uint32_t i = 0; i < 40; ++i)
+                moduli.push_back(primes[i] * (i % 10 == 0 ? primes[i + 1] : primes[40]));
+            moduli.push_back(random.exact_bits(128) * 2 + 1);
+            std::vector<BigInt> gcds = ProductTree::batch_gcd(moduli);
+            REQUIRE(ProductTree::batch_gcd(moduli, 3, 7) == gcds);
+            for (size_t i = 0; i < moduli.size(); ++i) {
+                BigInt others = 1;
+                for (size_t j = 0; j < moduli.size(); ++j)
+                    if (j != i)
+                        others *= moduli[j];
+                REQUIRE(gcds[i] == BigInt::gcd(moduli[i], others % moduli[i]));
+            }
+        }
+    }
+
     TEST_CASE("BigInt Division", "[division]") {
         BigInt number1 = BigInt("4556756767624525666272634167235675676762");
         BigInt number2 = BigInt("12345678901234567890");
@@ -141,6 +475,102 @@ namespace test_bintlib
             REQUIRE(result.first.to_string() == "-4");
             REQUIRE(result.second.to_string() == "2");
         }
+
+        SECTION("Check 5: div") {
+            BigInt number7 = BigInt("17917957937487618835702241799308144486896951787362286081099304740047021031501732669238897609516414664704");
+            auto result = BigInt::div(number7, BigInt(1) << 216);
+            REQUIRE(result.first.to_string() == "170141183461088201751329993853333667839");
+            REQUIRE(result.second == 0);
+        }
+
+        SECTION("Check 6: newton") {
+            BigIntRandom random(754);
+            BigInt divider = random.exact_bits(32 * BigInt::DIV_NEWTON_THRESHOLD + 45);
+            for (uint32_t bits : { 100u, 20000u, 33333u, 60000u }) {
+                BigInt number = random.exact_bits(bits);
+                auto result = BigInt::div(number, divider);
+                REQUIRE(result.first * divider + result.second == number);
+                REQUIRE(result.second < divider);
+                REQUIRE(result.second == number % divider);
+
+                result = BigInt::div(-number, divider);
+                REQUIRE(result.first * divider + result.second == -number);
+                REQUIRE(result.second >= 0);
+                REQUIRE(result.second < divider);
+            }
+            BigInt power = (BigInt(1) << (64 * BigInt::DIV_NEWTON_THRESHOLD)) - 1;
+            auto result = BigInt::div(power * power, power);
+            REQUIRE(result.first == power);
+            REQUIRE(result.second == 0);
+        }
+    }
+
+    TEST_CASE("BigInt Exact Division", "[divexact]") {
+        BigInt number1 = BigInt("4556756767624525666272634167235675676762");
+        BigInt number2 = BigInt("12345678901234567890");
+
+        SECTION("Check 1: word divider") {
+            REQUIRE(BigInt::divexact(number1 * 3, 3) == number1);
+            REQUIRE(BigInt::divexact(number1 * 96, 96) == number1);
+            REQUIRE(BigInt::divexact(-number1 * 4294967295u, 4294967295u) == -number1);
+            REQUIRE(BigInt::divexact(BigInt(0), 7) == 0);
+            REQUIRE_THROWS_AS(BigInt::divexact(number1, 0), std::invalid_argument);
+        }
+
+        SECTION("Check 2: divider") {
+            REQUIRE(BigInt::divexact(number1 * number2, number2) == number1);
+            REQUIRE(BigInt::divexact(number1 * number2, -number2) == -number1);
+            REQUIRE(BigInt::divexact(-(number1 << 100) * number2, number2 << 100) == -number1);
+            REQUIRE(BigInt::divexact(number2, number2) == 1);
+            REQUIRE_THROWS_AS(BigInt::divexact(number1, BigInt(0)), std::invalid_argument);
+        }
+
+        SECTION("Check 3: newton") {
+            BigIntRandom random(2025);
+            BigInt divider = random.exact_bits(32 * BigInt::DIV_NEWTON_THRESHOLD + 45);
+            for (uint32_t bits : { 100u, 20000u, 33333u, 60000u }) {
+                BigInt number = random.exact_bits(bits);
+                REQUIRE(BigInt::divexact(number * divider, divider) == number);
+                REQUIRE(BigInt::divexact(number * divider, number) == divider);
+            }
+        }
+    }
+
+    TEST_CASE("BigInt Scalar Operations", "[scalar]") {
+        BigInt number1 = BigInt("4556756767624525666272634167235675676762");
+        BigInt number2 = BigInt("-12345678901234567890");
+
+        SECTION("Check 1: sum/sub/mul") {
+            REQUIRE((number1 + 4294967295u).to_string() == "4556756767624525666272634167239970644057");
+            REQUIRE((number2 - (int64_t)-1234567890123456789).to_string() == "-11111111011111111101");
+            REQUIRE((number2 * UINT64_MAX).to_string() == "-227737579107269814010216029110176642350");
+            REQUIRE((7 - number2).to_string() == "12345678901234567897");
+        }
+
+        SECTION("Check 2: div/mod") {
+            auto result = BigInt::div_scalar(number1, 12345678901234567890ull);
+            REQUIRE(result.first.to_string() == "369097301499462292799");
+            REQUIRE(result.second == 1512927180252052652ull);
+            REQUIRE((number1 / 97).to_string() == "46976873893036347074975609971501811100");
+            REQUIRE(BigInt::mod_scalar(number1, 97) == 62);
+            REQUIRE((number2 % 1000000007).to_string() == "185183815");
+            REQUIRE((number2 / -3).to_string() == "4115226300411522630");
+        }
+
+        SECTION("Check 3: compare") {
+            REQUIRE(number2 < 0);
+            REQUIRE(number2 < -12345678901234567ll);
+            REQUIRE(number1 > UINT64_MAX);
+            REQUIRE(BigInt("-0") == 0);
+            REQUIRE(BigInt("18446744073709551615") == UINT64_MAX);
+        }
+
+        SECTION("Check 4: digits") {
+            BigInt result;
+            for (char digit : std::string("4556756767624525666272634167235675676762"))
+                result = result * 10 + (digit - '0');
+            REQUIRE(result == number1);
+        }
     }
 
     TEST_CASE("BigInt Module", "[module]") {
@@ -174,6 +604,12 @@ namespace test_bintlib
             std::string result = BigInt::gcd(number1, number2).to_string();
             REQUIRE(result == "12826");
         }
+
+        SECTION("Check 3: lcm") {
+            REQUIRE(BigInt::lcm(number1, number2) == number1 / 6413 * number2);
+            REQUIRE(BigInt::lcm(-number1, number2) == BigInt::lcm(number1, number2));
+            REQUIRE(BigInt::lcm(number1, 0) == 0);
+        }
     }
 
     TEST_CASE("BigInt Extended GCD", "[extended_gcd]") {
@@ -225,6 +661,137 @@ namespace test_bintlib
             std::string result = BigInt::left_shift(number2, 100).to_string();
             REQUIRE(result == "-15650007269374987633198475872814597484617284976640");
         }
+
+        SECTION("Check 3: whole chunks") {
+            BigInt shifted = BigInt::left_shift(number1, 320);
+            REQUIRE(BigInt::right_shift(shifted, 320) == number1);
+            REQUIRE(BigInt::right_shift(shifted, 321) == BigInt::right_shift(number1, 1));
+            REQUIRE(BigInt::left_shift(BigInt(0), 64).to_string() == "0");
+            REQUIRE(BigInt::right_shift(number1, 4096) == 0);
+        }
+
+        SECTION("Check 4: zero low chunks") {
+            BigInt lhs = BigInt::left_shift(BigInt::binary_pow(number1, 40), 5000);
+            BigInt rhs = BigInt::left_shift(BigInt::binary_pow(number2, 30), 3000);
+            REQUIRE(lhs * rhs == BigInt::left_shift(BigInt::binary_pow(number1, 40) * BigInt::binary_pow(number2, 30), 8000));
+            REQUIRE(lhs * lhs == BigInt::left_shift(BigInt::binary_pow(number1, 80), 10000));
+        }
+
+        SECTION("Check 5: implicit zero chunks") {
+            uint64_t shift = 32ull * 100000000 + 7;
+            BigInt huge = BigInt::left_shift(number1, shift);
+            REQUIRE(huge.bit_length() == number1.bit_length() + shift);
+            REQUIRE(huge.count_trailing_zeros() == number1.count_trailing_zeros() + shift);
+            REQUIRE(huge > number1);
+            REQUIRE(huge - huge == 0);
+            REQUIRE(BigInt::right_shift(huge + huge, shift) == number1 * 2);
+            REQUIRE(BigInt::right_shift(huge * huge, 2 * shift) == number1 * number1);
+            REQUIRE(BigInt::right_shift(huge * number2, shift) == number1 * number2);
+
+            BigInt value = huge;
+            value >>= shift - 40;
+            REQUIRE(value == BigInt::left_shift(number1, 40));
+            value <<= 1000;
+            value >>= 1003;
+            REQUIRE(value == BigInt::left_shift(number1, 37));
+        }
+    }
+
+    TEST_CASE("BigInt Bitwise", "[bitwise]") {
+        BigInt number1 = BigInt("4556756767624525666272634167235675676762");
+        BigInt number2 = BigInt("-12345678901234567890");
+
+        SECTION("Check 1: and, or, xor") {
+            REQUIRE((number1 & number2).to_string() == "4556756767624525666260956183833794895882");
+            REQUIRE((number1 | number2).to_string() == "-667695499353787010");
+            REQUIRE((number1 ^ number2).to_string() == "-4556756767624525666261623879333148682892");
+        }
+
+        SECTION("Check 2: not") {
+            REQUIRE((~number2).to_string() == "12345678901234567889");
+            REQUIRE(~~number1 == number1);
+        }
+
+        SECTION("Check 3: bits") {
+            REQUIRE(number2.test_bit(70));
+            REQUIRE(number1.popcount() == 62);
+            REQUIRE(number1.count_trailing_zeros() == 1);
+            REQUIRE(number2.extract_bits(40, 64) == 18446744073698323286ull);
+
+            BigInt number3 = number1;
+            number3.set_bit(200);
+            number3.set_bit(1, false);
+            REQUIRE(number3 == number1 + (BigInt(1) << 200) - 2);
+        }
+
+        SECTION("Check 4: low_bits") {
+            REQUIRE(BigInt::low_bits(number2, 100).to_string() == "1267650600215883722595468637486");
+            REQUIRE(BigInt::low_bits(number1, 100) == number1 % (BigInt(1) << 100));
+        }
+
+        SECTION("Check 5: in place") {
+            BigInt number3 = BigInt("12345678901234567890");
+            BigInt number4 = number1;
+            number4 &= number3;
+            REQUIRE(number4 == (number1 & number3));
+            number4 = number3;
+            number4 |= number1;
+            REQUIRE(number4 == (number1 | number3));
+            number4 ^= number1;
+            REQUIRE(number4 == ((number1 | number3) ^ number1));
+            number4 ^= number4;
+            REQUIRE(number4 == 0);
+            number4 = number1;
+            number4 &= number2;
+            REQUIRE(number4 == (number1 & number2));
+            number4 = -BigInt(0);
+            number4 |= number3;
+            REQUIRE(number4 == number3);
+        }
+    }
+
+    TEST_CASE("BigInt Multi-Gigabit", "[.huge]") {
+        BigInt number1 = BigInt("12345678901234567890");
+        uint64_t shift = ((uint64_t)1 << 32) + 37;
+        BigInt number2 = number1 << shift;
+
+        SECTION("Check 1: bits") {
+            REQUIRE(number2.bit_length() == shift + 64);
+            REQUIRE(number2.count_trailing_zeros() == shift + 1);
+            REQUIRE(number2.popcount() == number1.popcount());
+            REQUIRE(number2.extract_bits(shift, 64) == 12345678901234567890ull);
+            REQUIRE_FALSE(number2.test_bit(shift));
+            REQUIRE(number2.test_bit(shift + 1));
+        }
+
+        SECTION("Check 2: arithmetic") {
+            BigInt number3 = number2 + number2 + 1;
+            REQUIRE(number3 > number2);
+            REQUIRE(BigInt::low_bits(number3, shift) == 1);
+            REQUIRE((number3 >> (shift + 1)) == number1);
+            REQUIRE(number3 - number2 - number2 == 1);
+        }
+
+        SECTION("Check 3: dense limbs") {
+            BigInt number3 = (BigInt(1) << shift) - 1;
+            REQUIRE(number3.bit_length() == shift);
+            REQUIRE(number3.popcount() == shift);
+            REQUIRE(number3.extract_bits(shift - 64, 64) == UINT64_MAX);
+
+            BigInt number4 = number3 + number3;
+            REQUIRE(number4 > number3);
+            REQUIRE(number4.popcount() == shift);
+            REQUIRE((number4 >> 1) == number3);
+            number4 = (number3 << 37) >> 37;
+            REQUIRE(number4 == number3);
+            REQUIRE_FALSE(number4 < number3);
+
+            auto [quotient, remainder] = BigInt::div_scalar(number3, 7);
+            REQUIRE(remainder == 3);
+            number4 = number3 - 3;
+            REQUIRE(BigInt::divexact(number4, 7) == quotient);
+            REQUIRE(quotient * 7 + 3 == number3);
+        }
     }
 
     TEST_CASE("BigInt Binary Power", "[binary_power]") {
@@ -273,6 +840,45 @@ namespace test_bintlib
         }
     }
 
+    TEST_CASE("BigInt Roots", "[roots]") {
+        BigInt number1 = BigInt("4556756767624525666272634167235675676762");
+        BigInt number2 = BigInt("-12345678901234567890");
+
+        SECTION("Check 1: sqrt_rem") {
+            auto result = BigInt::sqrt_rem(number1);
+            REQUIRE(result.first.to_string() == "67503753729881760304");
+            REQUIRE(result.second.to_string() == "12408318769965504346");
+            REQUIRE_THROWS_AS(BigInt::isqrt(number2), std::invalid_argument);
+        }
+
+        SECTION("Check 2: root_rem") {
+            auto result = BigInt::root_rem(number1, 5);
+            REQUIRE(result.first.to_string() == "85453758");
+            REQUIRE(result.second.to_string() == "157695212223765473800966395343994");
+            result = BigInt::root_rem(number2, 3);
+            REQUIRE(result.first.to_string() == "-2311204");
+            REQUIRE(result.second.to_string() == "-3860450350226");
+            result = BigInt::root_rem(-BigInt(32), 5);
+            REQUIRE(result.first.to_string() == "-2");
+            REQUIRE(result.second.to_string() == "0");
+        }
+
+        SECTION("Check 3: large roots") {
+            BigInt base = BigInt::binary_pow(number1, 60) + 1;
+            REQUIRE(BigInt::isqrt(base * base) == base);
+            REQUIRE(BigInt::isqrt(base * base - 1) == base - 1);
+            REQUIRE(BigInt::iroot(BigInt::binary_pow(base, 7), 7) == base);
+            REQUIRE(BigInt::iroot(BigInt::binary_pow(base, 7) - 1, 7) == base - 1);
+        }
+
+        SECTION("Check 4: is_perfect_power") {
+            REQUIRE(BigInt::is_perfect_power(BigInt::binary_pow(number2, 11)));
+            REQUIRE(BigInt::is_perfect_power(BigInt(1) << 97));
+            REQUIRE_FALSE(BigInt::is_perfect_power(number1));
+            REQUIRE_FALSE(BigInt::is_perfect_power(-BigInt(16)));
+        }
+    }
+
     TEST_CASE("BigInt Montgomery Multiplication", "[montgomery_multiplication]") {
         BigInt number1 = BigInt("98765432101234567890123456789");
         BigInt number2 = BigInt("12345678909876543210987654321");
@@ -320,6 +926,459 @@ namespace test_bintlib
     }
 
 
+    TEST_CASE("ModInt Arithmetic", "[modint]") {
+        BigInt number1 = BigInt("98765432101234567890123456789");
+        BigInt number2 = BigInt("12345678909876543210987654321");
+        BigInt number3 = BigInt("6413641364136413641364136413");
+        BigInt module = BigInt("112233445566778899001122334455");
+        auto context = std::make_shared<MontgomeryContext>(module);
+
+        SECTION("Check 1: mul") {
+            ModInt a(context, number1);
+            ModInt b(context, number2);
+            REQUIRE((a * b).value().to_string() == "58175838322742367489756577539");
+        }
+
+        SECTION("Check 2: chain") {
+            ModInt a(context, number1);
+            ModInt b(context, number2);
+            ModInt c(context, -number3);
+            BigInt expected = BigInt::mod((number1 * number2 - number3) * number1 + number2, module);
+            REQUIRE(((a * b + c) * a + b).value() == expected);
+            REQUIRE((a - b - a).value() == module - number2);
+        }
+
+        SECTION("Check 3: pow") {
+            BigInt number4("202520252025202520252025202520252025");
+            BigInt number5("2904202529042025290420252904202529042025");
+            auto context2 = std::make_shared<MontgomeryContext>(BigInt("10000000000000000000000000000000007"));
+            REQUIRE(ModInt(context2, number4).pow(number5).value().to_string() == "4381271315878122186823853889463080");
+            REQUIRE(ModInt(context2, number4).pow(0).value() == 1);
+            REQUIRE((ModInt(context2, number4) * ModInt(context2, number4).inverse()).value() == 1);
+        }
+
+        SECTION("Check 4: even module") {
+            REQUIRE_THROWS_AS(MontgomeryContext(BigInt("1000")), std::invalid_argument);
+        }
+    }
+
+    TEST_CASE("BigInt Batch", "[batch]") {
+        BigInt number1("202520252025202520252025202520252025");
+        BigInt number2("2904202529042025290420252904202529042025");
+        BigInt module("10000000000000000000000000000000007");
+        std::vector<BigInt> numbers1, numbers2;
+        for (size_t i = 0; i < 300; ++i) {
+            numbers1.push_back(number1 * (i + 1) % module);
+            numbers2.push_back(number2 * (i + 7) % module);
+        }
+
+        SECTION("Check 1: gather and scatter") {
+            BigIntBatch batch = BigIntBatch::gather(numbers1, 4);
+            REQUIRE(batch.count() == 300);
+            REQUIRE(batch.limb(0)[1] == numbers1[1].extract_bits(0, 32));
+            REQUIRE(batch.scatter() == numbers1);
+            batch.set(5, 0);
+            REQUIRE(batch.get(5) == 0);
+            REQUIRE_THROWS_AS(batch.set(0, -number1), std::invalid_argument);
+            REQUIRE_THROWS_AS(BigIntBatch::gather({ number2 << 96 }, 4), std::invalid_argument);
+        }
+
+        SECTION("Check 2: add, sub and mul") {
+            BigIntBatch batch1 = BigIntBatch::gather(numbers1, 4);
+            BigIntBatch batch2 = BigIntBatch::gather(numbers2, 4);
+            std::vector<BigInt> sums = BigIntBatch::add(batch1, batch2).scatter();
+            std::vector<BigInt> differences = BigIntBatch::sub(batch1, batch2).scatter();
+            std::vector<BigInt> products = BigIntBatch::mul(batch1, batch2).scatter();
+            BigInt limit = BigInt(1) << 128;
+            for (size_t i = 0; i < numbers1.size(); ++i) {
+                REQUIRE(sums[i] == numbers1[i] + numbers2[i]);
+                REQUIRE(differences[i] == BigInt::mod(numbers1[i] - numbers2[i], limit));
+                REQUIRE(products[i] == numbers1[i] * numbers2[i]);
+            }
+        }
+
+        SECTION("Check 3: montgomery") {
+            BatchMontgomeryContext context(module);
+            BigIntBatch batch1 = context.to_montgomery(context.gather(numbers1));
+            BigIntBatch batch2 = context.to_montgomery(context.gather(numbers2));
+            std::vector<BigInt> sums = context.from_montgomery(context.add(batch1, batch2)).scatter();
+            std::vector<BigInt> differences = context.from_montgomery(context.sub(batch1, batch2)).scatter();
+            std::vector<BigInt> products = context.from_montgomery(context.mul(batch1, batch2)).scatter();
+            for (size_t i = 0; i < numbers1.size(); ++i) {
+                REQUIRE(sums[i] == (numbers1[i] + numbers2[i]) % module);
+                REQUIRE(differences[i] == (numbers1[i] - numbers2[i]) % module);
+                REQUIRE(products[i] == numbers1[i] * numbers2[i] % module);
+            }
+        }
+
+        SECTION("Check 4: montgomery pow") {
+            BatchMontgomeryContext context(module);
+            BigIntBatch batch = context.to_montgomery(context.gather({ number1, number1 + module, 0 }));
+            std::vector<BigInt> powers = context.from_montgomery(context.pow(batch, number2)).scatter();
+            REQUIRE(powers[0].to_string() == "4381271315878122186823853889463080");
+            REQUIRE(powers[1] == powers[0]);
+            REQUIRE(powers[2] == 0);
+            REQUIRE_THROWS_AS(BatchMontgomeryContext(BigInt("1000")), std::invalid_argument);
+            REQUIRE_THROWS_AS(context.mul(batch, BigIntBatch(3, 2)), std::invalid_argument);
+        }
+
+        SECTION("Check 5: empty batch") {
+            BatchMontgomeryContext context(module);
+            BigIntBatch batch = context.to_montgomery(context.gather({}));
+            REQUIRE(batch.count() == 0);
+            REQUIRE(context.from_montgomery(context.pow(context.mul(batch, batch), number2)).scatter().empty());
+            REQUIRE(BigIntBatch::broadcast(number1, 0, 4).count() == 0);
+            REQUIRE_THROWS_AS(BigIntBatch::broadcast(-number1, 0, 4), std::invalid_argument);
+        }
+    }
+
+    TEST_CASE("Barrett Reduction", "[barrett]") {
+        BigInt number1 = BigInt("4556756767624525666272634167235675676762");
+        BigInt number2 = BigInt("12345678901234567890123");
+        BigInt module = BigInt("20252025202520252025202520252024");
+        BarrettContext context(module);
+
+        SECTION("Check 1: reduce") {
+            REQUIRE(BigInt::mod(number1, context) == BigInt::mod(number1, module));
+            REQUIRE((number1 * number2) % context == (number1 * number2) % module);
+            REQUIRE((-number1) % context == BigInt::mod(-number1, module));
+        }
+
+        SECTION("Check 2: large input") {
+            BigInt number3 = BigInt::binary_pow(number1, 5);
+            REQUIRE(number3 % context == number3 % module);
+        }
+
+        SECTION("Check 3: pow") {
+            BarrettContext context2(BigInt("10000000000000000000000000000000007"));
+            BigInt number4("202520252025202520252025202520252025");
+            BigInt number5("2904202529042025290420252904202529042025");
+            REQUIRE(context2.pow(number4, number5).to_string() == "4381271315878122186823853889463080");
+        }
+    }
+
+    TEST_CASE("Fixed Base Exponentiation", "[fixed_base]") {
+        BigInt number1 = BigInt("202520252025202520252025202520252025");
+        BigInt number2 = BigInt("2904202529042025290420252904202529042025");
+        BigInt module = BigInt("10000000000000000000000000000000007");
+
+        SECTION("Check 1: pow") {
+            FixedBaseExp fixed_base(number1, module, 160);
+            REQUIRE(fixed_base.table_size() == 40 * 15);
+            REQUIRE(fixed_base.pow(number2).to_string() == "4381271315878122186823853889463080");
+            REQUIRE(fixed_base.pow(0) == 1);
+            REQUIRE(fixed_base.pow(1) == number1 % module);
+        }
+
+        SECTION("Check 2: window") {
+            MontgomeryContext context(module);
+            for (uint32_t window = 1; window <= 8; ++window) {
+                FixedBaseExp fixed_base(number1, module, 128, window);
+                REQUIRE(fixed_base.pow(number2 >> 32) == context.from_montgomery(context.pow(context.to_montgomery(number1), number2 >> 32)));
+            }
+        }
+
+        SECTION("Check 3: exponent above maximum size") {
+            FixedBaseExp fixed_base(number1, module, 64);
+            REQUIRE(fixed_base.pow(number2).to_string() == "4381271315878122186823853889463080");
+            REQUIRE_THROWS_AS(fixed_base.pow(-number2), std::invalid_argument);
+        }
+    }
+
+    TEST_CASE("Multi Exponentiation", "[multi_pow]") {
+        BigInt number1 = BigInt("202520252025202520252025202520252025");
+        BigInt number2 = BigInt("2904202529042025290420252904202529042025");
+        BigInt number3 = BigInt("4556756767624525666272634167235675676762");
+        BigInt module1 = BigInt("10000000000000000000000000000000007");
+        BigInt module2 = BigInt("20252025202520252025202520252024");
+
+        SECTION("Check 1: odd module") {
+            BarrettContext context(module1);
+            BigInt expected = context.mul(context.mul(context.pow(number1, number2), context.pow(number2, number3)), context.pow(number3, number1));
+            REQUIRE(BigInt::multi_pow_mod({ number1, number2, number3 }, { number2, number3, number1 }, module1) == expected);
+            REQUIRE(BigInt::multi_pow_mod({ number1 }, { number2 }, module1).to_string() == "4381271315878122186823853889463080");
+        }
+
+        SECTION("Check 2: even module") {
+            BarrettContext context(module2);
+            BigInt expected = context.mul(context.pow(-number1, number2), context.pow(number2, 65537));
+            REQUIRE(BigInt::multi_pow_mod({ -number1, number2 }, { number2, 65537 }, module2) == expected);
+        }
+
+        SECTION("Check 3: edge cases") {
+            REQUIRE(BigInt::multi_pow_mod({}, {}, module1) == 1);
+            REQUIRE(BigInt::multi_pow_mod({ number1, number2 }, { 0, 0 }, module1) == 1);
+            REQUIRE_THROWS_AS(BigInt::multi_pow_mod({ number1 }, { number2, number3 }, module1), std::invalid_argument);
+            REQUIRE_THROWS_AS(BigInt::multi_pow_mod({ number1 }, { -number2 }, module1), std::invalid_argument);
+        }
+    }
+
+    TEST_CASE("RSA CRT Exponentiation", "[rsa]") {
+        BigInt one = 1;
+        BigInt p = (one << 127) - 1;
+        BigInt q = (one << 89) - 1;
+        BigInt d = BigInt::mod_inverse(65537, (p - 1) * (q - 1));
+        BigInt message = BigInt("4556756767624525666272634167235675676762");
+        RsaCrtContext context(p, q, d);
+        BigInt cipher = BigInt::montgomery_pow(message, 65537, context.module(), 16);
+
+        SECTION("Check 1: decrypt") {
+            REQUIRE(context.module() == p * q);
+            REQUIRE(context.pow(cipher) == message);
+            REQUIRE(context.pow(message) == MontgomeryContext(p * q).from_montgomery(MontgomeryContext(p * q).pow(MontgomeryContext(p * q).to_montgomery(message), d)));
+        }
+
+        SECTION("Check 2: parallel") {
+            RsaCrtContext parallel_context(q, p, d, true);
+            REQUIRE(parallel_context.parallel());
+            REQUIRE(parallel_context.pow(cipher) == message);
+            REQUIRE(parallel_context.pow(0) == 0);
+        }
+
+        SECTION("Check 3: invalid keys") {
+            REQUIRE_THROWS_AS(RsaCrtContext(p, p, d), std::invalid_argument);
+            REQUIRE_THROWS_AS(RsaCrtContext(p, q, 0), std::invalid_argument);
+        }
+    }
+
+    TEST_CASE("Residue Number System", "[rns]") {
+        BigInt number1 = BigInt("4556756767624525666272634167235675676762");
+        BigInt number2 = BigInt("-12345678901234567890");
+        auto base = std::make_shared<const RnsBase>(RnsBase::generate(10));
+
+        SECTION("Check 1: base") {
+            RnsBase small({ 3, 5, 7 });
+            REQUIRE(small.product() == 105);
+            REQUIRE(small.to_residues(23) == std::vector<uint32_t>({ 2, 3, 2 }));
+            REQUIRE(small.from_residues({ 2, 3, 2 }) == 23);
+            REQUIRE(small.from_mixed_radix({ 2, 3, 2 }) == 23);
+            REQUIRE(small.to_residues(-BigInt(1)) == std::vector<uint32_t>({ 2, 4, 6 }));
+            REQUIRE(base->moduli().front() == 4294967291);
+            REQUIRE_THROWS_AS(RnsBase({ 6, 9 }), std::invalid_argument);
+        }
+
+        SECTION("Check 2: arithmetic") {
+            RnsInt a(base, number1);
+            RnsInt b(base, number2);
+            REQUIRE(a.value() == number1);
+            REQUIRE(b.signed_value() == number2);
+            REQUIRE((a * b).signed_value() == number1 * number2);
+            REQUIRE((a + b - a * a).signed_value() == number1 + number2 - number1 * number1);
+            REQUIRE((-a).signed_value() == -number1);
+            REQUIRE(base->from_mixed_radix((a * b).residues()) == (a * b).value());
+            REQUIRE(RnsInt::from_residues(base, a.residues()) == a);
+
+            RnsInt c = a;
+            c *= b;
+            c += a;
+            c -= b;
+            REQUIRE(c.signed_value() == number1 * number2 + number1 - number2);
+        }
+
+        SECTION("Check 3: montgomery") {
+            BigInt module = BigInt("10000000000000000000000000000000007");
+            RnsMontgomeryContext context(module);
+            REQUIRE(context.base().product() > module);
+            REQUIRE(context.from_montgomery(context.to_montgomery(number1)) == number1 % module);
+            REQUIRE(context.from_montgomery(context.mul(context.to_montgomery(number1), context.to_montgomery(number2))) == BigInt::mod(number1 * number2, module));
+            REQUIRE(context.pow(BigInt("202520252025202520252025202520252025"), BigInt("2904202529042025290420252904202529042025")).to_string() == "4381271315878122186823853889463080");
+
+            BigInt one = 1;
+            BigInt mersenne = (one << 521) - 1;
+            RnsMontgomeryContext context2(mersenne);
+            REQUIRE(context2.pow(number1, mersenne - 1) == 1);
+        }
+    }
+
+    TEST_CASE("Primality", "[primality]") {
+        BigInt one = 1;
+        BigInt mersenne1 = (one << 127) - 1;
+        BigInt mersenne2 = (one << 521) - 1;
+
+        SECTION("Check 1: trial division") {
+            REQUIRE(Primality::sieve(30) == std::vector<uint32_t>{ 2, 3, 5, 7, 11, 13, 17, 19, 23, 29 });
+            REQUIRE(Primality::trial_division(BigInt(97)) == 0);
+            REQUIRE(Primality::trial_division(BigInt(91)) == 7);
+            REQUIRE(Primality::trial_division(mersenne1 * 4093) == 4093);
+            REQUIRE(Primality::trial_division(mersenne1 * 4093, 4000) == 0);
+            REQUIRE(Primality::trial_division(mersenne1) == 0);
+        }
+
+        SECTION("Check 2: jacobi") {
+            REQUIRE(Primality::jacobi(BigInt(5), BigInt(19)) == 1);
+            REQUIRE(Primality::jacobi(BigInt::from_scalar(7, true), BigInt(19)) == -1);
+            REQUIRE(Primality::jacobi(BigInt(1001), BigInt(9907)) == -1);
+            REQUIRE(Primality::jacobi(BigInt(21), BigInt(15)) == 0);
+        }
+
+        SECTION("Check 3: miller rabin") {
+            REQUIRE(Primality::miller_rabin(BigInt(2047), { BigInt(2) }));
+            REQUIRE(!Primality::miller_rabin(BigInt(2047), { BigInt(2), BigInt(3) }));
+            REQUIRE(Primality::miller_rabin(mersenne2, 8));
+            REQUIRE(!Primality::miller_rabin(mersenne1 * mersenne2, 8));
+        }
+
+        SECTION("Check 4: bpsw") {
+            REQUIRE(Primality::strong_lucas(BigInt(5459)));
+            REQUIRE(!Primality::bpsw(BigInt(5459)));
+            REQUIRE(!Primality::bpsw(BigInt(561)));
+            REQUIRE(!Primality::bpsw(BigInt("3825123056546413051")));
+            REQUIRE(Primality::bpsw(BigInt(65537)));
+            REQUIRE(Primality::bpsw(mersenne1));
+            REQUIRE(Primality::is_probable_prime(mersenne2, 4));
+            REQUIRE(!Primality::bpsw((one << 128) + 1));
+        }
+
+        SECTION("Check 5: random prime") {
+            for (uint32_t bits : { 2, 3, 17, 64, 200 }) {
+                BigInt prime = Primality::random_prime(bits, bits);
+                REQUIRE(prime.bit_length() == bits);
+                REQUIRE(Primality::bpsw(prime));
+            }
+            REQUIRE(Primality::random_prime(256, 7, 1) == Primality::random_prime(256, 7, 4));
+        }
+    }
+
+    TEST_CASE("BigInt Random", "[random]") {
+        BigInt bound = BigInt("4556756767624525666272634167235675676762");
+
+        SECTION("Check 1: seed") {
+            BigIntRandom random1(2025);
+            BigIntRandom random2(2025);
+            BigIntRandom random3(2026);
+            BigInt number = random1.bits(2048);
+            REQUIRE(number == random2.bits(2048));
+            REQUIRE(number != random3.bits(2048));
+            REQUIRE(random1() == random2());
+        }
+
+        SECTION("Check 2: bits") {
+            BigIntRandom random(1);
+            for (uint32_t bits : { 1, 31, 32, 33, 64, 100, 2048 }) {
+                REQUIRE(random.exact_bits(bits).bit_length() == bits);
+                REQUIRE(random.bits(bits).bit_length() <= bits);
+            }
+            REQUIRE(random.bits(0) == 0);
+        }
+
+        SECTION("Check 3: below") {
+            BigIntRandom random(2);
+            std::vector<int> counts(10, 0);
+            for (size_t i = 0; i < 1000; ++i) {
+                BigInt number = random.below(bound);
+                REQUIRE(number >= 0);
+                REQUIRE(number < bound);
+                counts[BigInt::mod_scalar(random.below(10), 10)]++;
+            }
+            for (int count : counts)
+                REQUIRE(count > 50);
+            REQUIRE(random.below(1) == 0);
+            REQUIRE(random.range(-bound, -bound + 1) == -bound);
+            REQUIRE_THROWS_AS(random.below(0), std::invalid_argument);
+        }
+
+        SECTION("Check 4: entropy source") {
+            uint64_t counter = 0;
+            BigIntRandom::EntropySource entropy = [&counter]() { return counter++; };
+            BigIntRandom random1(entropy);
+            counter = 0;
+            BigIntRandom random2(entropy);
+            REQUIRE(random1.bits(256) == random2.bits(256));
+            BigIntRandom random3(BigIntRandom::EntropySource{});
+            REQUIRE(random3.exact_bits(128).bit_length() == 128);
+        }
+    }
+
+    TEST_CASE("Special Form Reduction", "[reduction]") {
+        BigInt one = 1;
+        BigInt number1 = BigInt("4556756767624525666272634167235675676762455675676762452566627263416723567567676245567567676245256662726341672356756767624556");
+        BigInt number2 = BigInt::binary_pow(number1, 3);
+
+        SECTION("Check 1: form detection") {
+            REQUIRE(ReductionContext((one << 127) - 1).form() == ReductionContext::Form::pseudo_mersenne);
+            REQUIRE(ReductionContext((one << 255) - 19).form() == ReductionContext::Form::pseudo_mersenne);
+            REQUIRE(ReductionContext((one << 255) + 95).form() == ReductionContext::Form::pseudo_mersenne);
+            REQUIRE(ReductionContext((one << 256) - (one << 224) + (one << 192) + (one << 96) - 1).form() == ReductionContext::Form::solinas);
+            REQUIRE(ReductionContext(BigInt("20252025202520252025202520252024")).form() == ReductionContext::Form::barrett);
+        }
+
+        SECTION("Check 2: reduce") {
+            std::vector<BigInt> modules = { (one << 127) - 1, (one << 255) - 19, (one << 255) + 95, (one << 256) - (one << 224) + (one << 192) + (one << 96) - 1, (one << 448) - (one << 224) - 1, BigInt("20252025202520252025202520252024") };
+            for (auto& module : modules) {
+                ReductionContext context(module);
+                REQUIRE(context.reduce(number1) == number1 % module);
+                REQUIRE(context.reduce(number2) == number2 % module);
+                REQUIRE(context.reduce(-number2) == (-number2) % module);
+                REQUIRE(context.mul(number1, number2 % module) == (number1 * number2) % module);
+            }
+        }
+
+        SECTION("Check 3: pow") {
+            BigInt module = (one << 127) - 1;
+            ReductionContext context(module);
+            BarrettContext barrett(module);
+            REQUIRE(context.pow(number1, number2) == barrett.pow(number1, number2));
+            REQUIRE(context.pow(number1, module - 1) == 1);
+        }
+    }
+
+    TEST_CASE("FixedBigInt Arithmetic", "[fixed]") {
+        BigInt number1 = BigInt("98765432101234567890123456789");
+        BigInt number2 = BigInt("12345678909876543210987654321");
+        FixedBigUInt<128> fixed1(number1);
+        FixedBigUInt<128> fixed2(number2);
+
+        static_assert(FixedBigUInt<64>(5) + FixedBigUInt<64>(7) == FixedBigUInt<64>(12));
+        static_assert((FixedBigUInt<64>(1) << 40) >> 38 == FixedBigUInt<64>(4));
+        static_assert(FixedBigInt<64>(-3) * FixedBigInt<64>(5) == FixedBigInt<64>(-15));
+
+        SECTION("Check 1: add/sub/mul") {
+            REQUIRE((fixed1 + fixed2).to_bigint() == number1 + number2);
+            REQUIRE((fixed1 - fixed2).to_bigint() == number1 - number2);
+            REQUIRE(FixedBigUInt<128>::mul_wide(fixed1, fixed2).to_bigint() == number1 * number2);
+            REQUIRE((fixed2 - fixed1).to_bigint() == (BigInt(1) << 128) + number2 - number1);
+        }
+
+        SECTION("Check 2: shift/compare") {
+            REQUIRE((fixed1 << 20).to_bigint() == number1 << 20);
+            REQUIRE((fixed1 >> 70).to_bigint() == number1 >> 70);
+            REQUIRE(fixed1 > fixed2);
+            REQUIRE(fixed2 <= fixed1);
+            REQUIRE(fixed1.bit_length() == number1.bit_length());
+        }
+
+        SECTION("Check 3: signed") {
+            FixedBigInt<128> signed1(-number1);
+            FixedBigInt<128> signed2(number2);
+            REQUIRE(signed1.is_negative());
+            REQUIRE((signed1 + signed2).to_bigint() == number2 - number1);
+            REQUIRE((signed1 * FixedBigInt<128>(3)).to_bigint().to_string() == "-296296296303703703670370370367");
+            REQUIRE((signed1 >> 4).to_bigint().to_string() == "-6172839506327160493132716050");
+            REQUIRE(signed1 < signed2);
+        }
+    }
+
+    TEST_CASE("FixedBigInt Montgomery", "[fixed_montgomery]") {
+        BigInt number1 = BigInt("98765432101234567890123456789");
+        BigInt number2 = BigInt("12345678909876543210987654321");
+        BigInt module = BigInt("112233445566778899001122334455");
+
+        FixedMontgomery<128> context((FixedBigUInt<128>(module)));
+
+        SECTION("Check 1: mul_mod") {
+            FixedBigUInt<128> result = context.mul_mod(FixedBigUInt<128>(number1), FixedBigUInt<128>(number2));
+            REQUIRE(result.to_bigint().to_string() == "58175838322742367489756577539");
+        }
+
+        SECTION("Check 2: pow") {
+            BigInt number3("202520252025202520252025202520252025");
+            BigInt number4("2904202529042025290420252904202529042025");
+            FixedMontgomery<128> context2((FixedBigUInt<128>(BigInt("10000000000000000000000000000000007"))));
+            FixedBigUInt<128> result = context2.pow(FixedBigUInt<128>(number3), FixedBigUInt<160>(number4));
+            REQUIRE(result.to_bigint().to_string() == "4381271315878122186823853889463080");
+        }
+    }
+
     TEST_CASE("BigInt Comparison", "[comparison]") {
         BigInt number1 = BigInt("-12345678901234567890");
         BigInt number2 = BigInt("455675676762455675676762");